@@ -52,4 +52,34 @@ Maestro::Evolve ()
 			Print() << "\tPhi = " << phi_exact[idx] << ",   Abs norm = " << abs_norm << ",  Rel norm = " << rel_norm << std::endl;
 		}
 	}
+
+	// the batched Average has to give the same averages as one call per
+	// quantity
+	Vector<MultiFab> phi2(finest_level+1);
+	for (int lev=0; lev<=finest_level; ++lev) {
+		phi2[lev].define(grids[lev], dmap[lev], 1, 0);
+	}
+	Put1dArrayOnCart(rho0_old, phi2, 0, 0);
+
+	const int nsum = (base_geom.max_radial_level+1)*nr_fine;
+	RealVector phi_single(nsum), phi2_single(nsum);
+	RealVector phi_batch(nsum), phi2_batch(nsum);
+
+	Average(phi, phi_single, 0);
+	Average(phi2, phi2_single, 0);
+	Average({&phi, &phi2}, {&phi_batch, &phi2_batch}, {0, 0});
+
+	// on the CPU the results are identical; on GPUs the atomic sums may
+	// round differently
+	Real max_diff = 0.0;
+	for (int i = 0; i < nsum; ++i) {
+		const Real diff = std::abs(phi_batch[i] - phi_single[i]) /
+			amrex::max(std::abs(phi_single[i]), 1.e-300);
+		const Real diff2 = std::abs(phi2_batch[i] - phi2_single[i]) /
+			amrex::max(std::abs(phi2_single[i]), 1.e-300);
+		max_diff = amrex::max(max_diff, amrex::max(diff, diff2));
+	}
+
+	Print() << "Batched Average: max rel difference from single Average = " << max_diff
+	        << (max_diff <= 1.e-13 ? "  PASSED" : "  FAILED") << std::endl;
 }
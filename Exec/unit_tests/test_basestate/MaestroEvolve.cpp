@@ -1,6 +1,11 @@
 
 #include <Maestro.H>
 #include <Problem_F.H>
+#include <MaestroBaseStateIO.H>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 
 using namespace amrex;
 
@@ -79,4 +84,101 @@ Maestro::Evolve ()
 	Real max_hse_error;
 	check_hseness(rho0_old.dataPtr(), p0_old.dataPtr(), &max_hse_error);
 	Print() << "Maximum HSE error = " << max_hse_error << std::endl;
+
+	// the partitioned tridiagonal solve has to agree with the serial one
+	{
+		const int n = 10000;
+		BaseState<Real> a_s(1, n), b_s(1, n), c_s(1, n), r_s(1, n);
+		BaseState<Real> u_serial_s(1, n), u_block_s(1, n);
+		auto a = a_s.array();
+		auto b = b_s.array();
+		auto c = c_s.array();
+		auto r = r_s.array();
+		auto u_serial = u_serial_s.array();
+		auto u_block = u_block_s.array();
+
+		for (int j = 0; j < n; ++j) {
+			a(j) = (j > 0) ? -1.0 : 0.0;
+			c(j) = (j < n-1) ? -1.0 : 0.0;
+			b(j) = 2.5 + 0.5*std::sin(0.1*j);
+			r(j) = std::cos(0.01*j);
+		}
+
+		const int block_size = w0_tridiag_block_size;
+
+		w0_tridiag_block_size = 0;
+		Tridiag(a, b, c, r, u_serial, n);
+
+		// an uneven number of blocks, so they are not all the same size
+		w0_tridiag_block_size = 701;
+		Tridiag(a, b, c, r, u_block, n);
+
+		w0_tridiag_block_size = block_size;
+
+		Real max_diff = 0.0;
+		Real max_u = 0.0;
+		for (int j = 0; j < n; ++j) {
+			max_diff = amrex::max(max_diff, std::abs(u_block(j) - u_serial(j)));
+			max_u = amrex::max(max_u, std::abs(u_serial(j)));
+		}
+		max_diff /= max_u;
+
+		Print() << "Partitioned tridiagonal solve: max rel difference from serial = "
+		        << max_diff << (max_diff <= 1.e-12 ? "  PASSED" : "  FAILED") << std::endl;
+	}
+
+	// the binary base state files of checkpoints have to read back
+	// exactly what was written
+	{
+		const std::string cc_file = "test_basestate_BaseCC";
+		const std::string fc_file = "test_basestate_BaseFC";
+
+		const int ncc = rho0_old.size();
+		const int nfc = w0.size();
+
+		if (ParallelDescriptor::IOProcessor()) {
+			const Vector<const Real*> cc_cols = {rho0_old.dataPtr(), p0_old.dataPtr(),
+			                                     gamma1bar_old.dataPtr(), rhoh0_old.dataPtr(),
+			                                     tempbar.dataPtr()};
+			const Vector<const Real*> fc_cols = {w0.dataPtr()};
+
+			std::ofstream cc(cc_file, std::ofstream::out | std::ofstream::trunc |
+			                 std::ofstream::binary);
+			cc << BaseStateBinary::Pack(cc_cols, ncc);
+			std::ofstream fc(fc_file, std::ofstream::out | std::ofstream::trunc |
+			                 std::ofstream::binary);
+			fc << BaseStateBinary::Pack(fc_cols, nfc);
+		}
+		ParallelDescriptor::Barrier();
+
+		RealVector rho0_in(ncc), p0_in(ncc), gamma1bar_in(ncc), rhoh0_in(ncc), tempbar_in(ncc);
+		RealVector w0_in(nfc);
+
+		Vector<char> fileCharPtr;
+		ParallelDescriptor::ReadAndBcastFile(cc_file, fileCharPtr);
+		BaseStateBinary::Unpack(fileCharPtr.dataPtr(), fileCharPtr.size(),
+		                        {rho0_in.dataPtr(), p0_in.dataPtr(), gamma1bar_in.dataPtr(),
+		                         rhoh0_in.dataPtr(), tempbar_in.dataPtr()},
+		                        ncc, cc_file);
+		ParallelDescriptor::ReadAndBcastFile(fc_file, fileCharPtr);
+		BaseStateBinary::Unpack(fileCharPtr.dataPtr(), fileCharPtr.size(),
+		                        {w0_in.dataPtr()}, nfc, fc_file);
+
+		const bool same =
+			std::memcmp(rho0_in.dataPtr(), rho0_old.dataPtr(), ncc*sizeof(Real)) == 0 &&
+			std::memcmp(p0_in.dataPtr(), p0_old.dataPtr(), ncc*sizeof(Real)) == 0 &&
+			std::memcmp(gamma1bar_in.dataPtr(), gamma1bar_old.dataPtr(), ncc*sizeof(Real)) == 0 &&
+			std::memcmp(rhoh0_in.dataPtr(), rhoh0_old.dataPtr(), ncc*sizeof(Real)) == 0 &&
+			std::memcmp(tempbar_in.dataPtr(), tempbar.dataPtr(), ncc*sizeof(Real)) == 0 &&
+			std::memcmp(w0_in.dataPtr(), w0.dataPtr(), nfc*sizeof(Real)) == 0;
+
+		Print() << "Binary base state files: round trip "
+		        << (same ? "PASSED" : "FAILED") << std::endl;
+
+		ParallelDescriptor::Barrier();
+		if (ParallelDescriptor::IOProcessor()) {
+			std::remove(cc_file.c_str());
+			std::remove(fc_file.c_str());
+		}
+	}
 }
@@ -113,7 +113,7 @@ BaseStateGeometry::Init(const int max_radial_level_in,
 }
 
 void 
-BaseStateGeometry::ComputeCutoffCoords(const BaseStateArray<Real>& rho0)
+BaseStateGeometry::ComputeCutoffCoords(const BaseStateArray<const Real>& rho0)
 {
     // timer for profiling
     BL_PROFILE_VAR("BaseStateGeometry::ComputeCutoffCoords", ComputeCutoffCoords); 
@@ -11,6 +11,10 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::AdvanceTimeStep()",AdvanceTimeStep);
 
+    // reset the per-step timing ledger
+    TimingLedgerBegin();
+    TimingLedgerMark("setup:allocate");
+
     // timers
     Real advect_time =0., advect_time_start;
     Real macproj_time=0., macproj_time_start;
@@ -130,54 +134,56 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
 
     for (int lev=0; lev<=finest_level; ++lev) {
         // cell-centered MultiFabs
-        rhohalf     [lev].define(grids[lev], dmap[lev],       1,    1);
-        macrhs      [lev].define(grids[lev], dmap[lev],       1,    0);
-        macphi      [lev].define(grids[lev], dmap[lev],       1,    1);
-        S_cc_nph    [lev].define(grids[lev], dmap[lev],       1,    0);
-        rho_omegadot[lev].define(grids[lev], dmap[lev], NumSpec,    0);
-        thermal1    [lev].define(grids[lev], dmap[lev],       1,    0);
-        thermal2    [lev].define(grids[lev], dmap[lev],       1,    0);
-        rho_Hnuc    [lev].define(grids[lev], dmap[lev],       1,    0);
-        rho_Hext    [lev].define(grids[lev], dmap[lev],       1,    0);
-        s1          [lev].define(grids[lev], dmap[lev],   Nscal, ng_s);
+        ScratchAlloc(rhohalf[lev],           grids[lev], dmap[lev],       1,    1);
+        ScratchAlloc(macrhs[lev],            grids[lev], dmap[lev],       1,    0);
+        ScratchAlloc(macphi[lev],            grids[lev], dmap[lev],       1,    1);
+        ScratchAlloc(S_cc_nph[lev],          grids[lev], dmap[lev],       1,    0);
+        ScratchAlloc(rho_omegadot[lev],      grids[lev], dmap[lev], NumSpec,    0);
+        ScratchAlloc(thermal1[lev],          grids[lev], dmap[lev],       1,    0);
+        ScratchAlloc(thermal2[lev],          grids[lev], dmap[lev],       1,    0);
+        ScratchAlloc(rho_Hnuc[lev],          grids[lev], dmap[lev],       1,    0);
+        ScratchAlloc(rho_Hext[lev],          grids[lev], dmap[lev],       1,    0);
+        ScratchAlloc(s1[lev],                grids[lev], dmap[lev],   Nscal, ng_s);
         s1[lev].setVal(0.);
-        s2          [lev].define(grids[lev], dmap[lev],   Nscal, ng_s);
-        s2star      [lev].define(grids[lev], dmap[lev],   Nscal, ng_s);
-        delta_gamma1_term[lev].define(grids[lev], dmap[lev],  1,    0);
-        delta_gamma1[lev].define(grids[lev], dmap[lev],       1,    0);
-        peosbar_cart[lev].define(grids[lev], dmap[lev],       1,    0);
-        delta_p_term[lev].define(grids[lev], dmap[lev],       1,    0);
-        Tcoeff      [lev].define(grids[lev], dmap[lev],       1,    1);
-        hcoeff1     [lev].define(grids[lev], dmap[lev],       1,    1);
-        Xkcoeff1    [lev].define(grids[lev], dmap[lev], NumSpec,    1);
-        pcoeff1     [lev].define(grids[lev], dmap[lev],       1,    1);
-        hcoeff2     [lev].define(grids[lev], dmap[lev],       1,    1);
-        Xkcoeff2    [lev].define(grids[lev], dmap[lev], NumSpec,    1);
-        pcoeff2     [lev].define(grids[lev], dmap[lev],       1,    1);
+        ScratchAlloc(s2[lev],                grids[lev], dmap[lev],   Nscal, ng_s);
+        ScratchAlloc(s2star[lev],            grids[lev], dmap[lev],   Nscal, ng_s);
+        ScratchAlloc(delta_gamma1_term[lev], grids[lev], dmap[lev],       1,    0);
+        ScratchAlloc(delta_gamma1[lev],      grids[lev], dmap[lev],       1,    0);
+        ScratchAlloc(peosbar_cart[lev],      grids[lev], dmap[lev],       1,    0);
+        ScratchAlloc(delta_p_term[lev],      grids[lev], dmap[lev],       1,    0);
+        ScratchAlloc(Tcoeff[lev],            grids[lev], dmap[lev],       1,    1);
+        ScratchAlloc(hcoeff1[lev],           grids[lev], dmap[lev],       1,    1);
+        ScratchAlloc(Xkcoeff1[lev],          grids[lev], dmap[lev], NumSpec,    1);
+        ScratchAlloc(pcoeff1[lev],           grids[lev], dmap[lev],       1,    1);
+        ScratchAlloc(hcoeff2[lev],           grids[lev], dmap[lev],       1,    1);
+        ScratchAlloc(Xkcoeff2[lev],          grids[lev], dmap[lev], NumSpec,    1);
+        ScratchAlloc(pcoeff2[lev],           grids[lev], dmap[lev],       1,    1);
         if (ppm_trace_forces == 0) {
-            scal_force  [lev].define(grids[lev], dmap[lev],   Nscal,    1);
+            ScratchAlloc(scal_force[lev], grids[lev], dmap[lev], Nscal,    1);
         } else {
             // we need more ghostcells if we are tracing the forces
-            scal_force  [lev].define(grids[lev], dmap[lev],   Nscal, ng_s);
+            ScratchAlloc(scal_force[lev], grids[lev], dmap[lev], Nscal, ng_s);
         }
-        delta_chi   [lev].define(grids[lev], dmap[lev],       1,    0);
-        sponge      [lev].define(grids[lev], dmap[lev],       1,    0);
+        ScratchAlloc(delta_chi[lev],         grids[lev], dmap[lev],       1,    0);
+        ScratchAlloc(sponge[lev],            grids[lev], dmap[lev],       1,    0);
 
         // face-centered in the dm-direction (planar only)
-        AMREX_D_TERM(etarhoflux[lev].define(convert(grids[lev],nodal_flag_x), dmap[lev], 1, 1); ,
-                     etarhoflux[lev].define(convert(grids[lev],nodal_flag_y), dmap[lev], 1, 1); ,
-                     etarhoflux[lev].define(convert(grids[lev],nodal_flag_z), dmap[lev], 1, 1); );
+#if (AMREX_SPACEDIM == 2)
+        ScratchAlloc(etarhoflux[lev], convert(grids[lev],nodal_flag_y), dmap[lev], 1, 1);
+#else
+        ScratchAlloc(etarhoflux[lev], convert(grids[lev],nodal_flag_z), dmap[lev], 1, 1);
+#endif
 
         // face-centered arrays of MultiFabs
-        AMREX_D_TERM(umac [lev][0].define(convert(grids[lev],nodal_flag_x), dmap[lev], 1,     1); ,
-                     umac [lev][1].define(convert(grids[lev],nodal_flag_y), dmap[lev], 1,     1); ,
-                     umac [lev][2].define(convert(grids[lev],nodal_flag_z), dmap[lev], 1,     1); );
-        AMREX_D_TERM(sedge[lev][0].define(convert(grids[lev],nodal_flag_x), dmap[lev], Nscal, 0); ,
-                     sedge[lev][1].define(convert(grids[lev],nodal_flag_y), dmap[lev], Nscal, 0); ,
-                     sedge[lev][2].define(convert(grids[lev],nodal_flag_z), dmap[lev], Nscal, 0); );
-        AMREX_D_TERM(sflux[lev][0].define(convert(grids[lev],nodal_flag_x), dmap[lev], Nscal, 0); ,
-                     sflux[lev][1].define(convert(grids[lev],nodal_flag_y), dmap[lev], Nscal, 0); ,
-                     sflux[lev][2].define(convert(grids[lev],nodal_flag_z), dmap[lev], Nscal, 0); );
+        AMREX_D_TERM(ScratchAlloc(umac[lev][0], convert(grids[lev],nodal_flag_x), dmap[lev], 1,     1); ,
+                     ScratchAlloc(umac[lev][1], convert(grids[lev],nodal_flag_y), dmap[lev], 1,     1); ,
+                     ScratchAlloc(umac[lev][2], convert(grids[lev],nodal_flag_z), dmap[lev], 1,     1); );
+        AMREX_D_TERM(ScratchAlloc(sedge[lev][0], convert(grids[lev],nodal_flag_x), dmap[lev], Nscal, 0); ,
+                     ScratchAlloc(sedge[lev][1], convert(grids[lev],nodal_flag_y), dmap[lev], Nscal, 0); ,
+                     ScratchAlloc(sedge[lev][2], convert(grids[lev],nodal_flag_z), dmap[lev], Nscal, 0); );
+        AMREX_D_TERM(ScratchAlloc(sflux[lev][0], convert(grids[lev],nodal_flag_x), dmap[lev], Nscal, 0); ,
+                     ScratchAlloc(sflux[lev][1], convert(grids[lev],nodal_flag_y), dmap[lev], Nscal, 0); ,
+                     ScratchAlloc(sflux[lev][2], convert(grids[lev],nodal_flag_z), dmap[lev], Nscal, 0); );
 
         // initialize umac
         for (int d=0; d < AMREX_SPACEDIM; ++d) {
@@ -186,14 +192,14 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
             sflux[lev][d].setVal(0.);
         }
 
-        w0_force_cart[lev].define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
+        ScratchAlloc(w0_force_cart[lev], grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
     }
 
 #if (AMREX_SPACEDIM == 3)
     for (int lev=0; lev<=finest_level; ++lev) {
-        w0mac[lev][0].define(convert(grids[lev],nodal_flag_x), dmap[lev], 1, 1);
-        w0mac[lev][1].define(convert(grids[lev],nodal_flag_y), dmap[lev], 1, 1);
-        w0mac[lev][2].define(convert(grids[lev],nodal_flag_z), dmap[lev], 1, 1);
+        ScratchAlloc(w0mac[lev][0], convert(grids[lev],nodal_flag_x), dmap[lev], 1, 1);
+        ScratchAlloc(w0mac[lev][1], convert(grids[lev],nodal_flag_y), dmap[lev], 1, 1);
+        ScratchAlloc(w0mac[lev][2], convert(grids[lev],nodal_flag_z), dmap[lev], 1, 1);
     }
 #endif
 
@@ -213,6 +219,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
 
     react_time_start = ParallelDescriptor::second();
 
+    TimingLedgerMark("step1:react_state");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 1 : react state >>>" << std::endl;
     }
@@ -229,6 +237,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
 
     advect_time_start = ParallelDescriptor::second();
 
+    TimingLedgerMark("step2:make_w0");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 2 : make w0 >>>" << std::endl;
     }
@@ -302,8 +312,6 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
         base_time_start = ParallelDescriptor::second();
 
         ComputeCutoffCoords(rho0_old);
-        BaseState<Real> rho0_state(rho0_old, base_geom.max_radial_level+1, base_geom.nr_fine);
-        base_geom.ComputeCutoffCoords(rho0_state.array());
 
         // compute w0, w0_force, and delta_chi_w0
         is_predictor = 1;
@@ -336,6 +344,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
     // STEP 3 -- construct the advective velocity
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step3:create_mac_velocities");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 3 : create MAC velocities >>>" << std::endl;
     }
@@ -359,6 +369,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
     ParallelDescriptor::ReduceRealMax(advect_time,ParallelDescriptor::IOProcessorNumber());
     ParallelDescriptor::Bcast(&advect_time,1,ParallelDescriptor::IOProcessorNumber());
 
+    TimingLedgerMark("step3:mac_proj");
+
     macproj_time_start = ParallelDescriptor::second();
 
     // MAC projection
@@ -375,6 +387,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
 
     advect_time_start = ParallelDescriptor::second();
 
+    TimingLedgerMark("step4:advect_base");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 4 : advect base >>>" << std::endl;
     }
@@ -392,8 +406,6 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
 
         compute_cutoff_coords(rho0_new.dataPtr());
         ComputeCutoffCoords(rho0_new);
-        BaseState<Real> rho0_state(rho0_new, base_geom.max_radial_level+1, base_geom.nr_fine);
-        base_geom.ComputeCutoffCoords(rho0_state.array());
     }
     else {
         rho0_new = rho0_old;
@@ -419,6 +431,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
         MultiFab::Copy(s2[lev],s1[lev],Temp,Temp,1,ng_s);
     }
 
+    TimingLedgerMark("step4:density_advance");
+
     if (maestro_verbose >= 1) {
         Print() << "            :  density_advance >>>" << std::endl;
         Print() << "            :   tracer_advance >>>" << std::endl;
@@ -448,12 +462,12 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
                 MakeEtarhoSphr(s1, s2, umac, w0mac);
             }
 
-            // correct the base state density by "averaging"
-            Average(s2, rho0_new, Rho);
+            // correct the base state density by "averaging".  rhoh0_old,
+            // which is needed for the enthalpy update below, only depends
+            // on s1, so it is averaged in the same reduction
+            Average({&s2, &s1}, {&rho0_new, &rhoh0_old}, {Rho, RhoH});
             compute_cutoff_coords(rho0_new.dataPtr());
             ComputeCutoffCoords(rho0_new);
-            BaseState<Real> rho0_state(rho0_new, base_geom.max_radial_level+1, base_geom.nr_fine);
-            base_geom.ComputeCutoffCoords(rho0_state.array());
         }
 
         // update grav_cell_new
@@ -486,11 +500,10 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
                 p0_nph[i] = 0.5*(p0_old[i] + p0_new[i]);
             }
 
-            // compute gamma1bar^{(1)} and store it in gamma1bar_temp1
-            MakeGamma1bar(s1, gamma1bar_temp1, p0_old);
-
-            // compute gamma1bar^{(2),*} and store it in gamma1bar_temp2
-            MakeGamma1bar(s2, gamma1bar_temp2, p0_new);
+            // compute gamma1bar^{(1)} and store it in gamma1bar_temp1, and
+            // gamma1bar^{(2),*} and store it in gamma1bar_temp2
+            MakeGamma1bar({&s1, &s2}, {&gamma1bar_temp1, &gamma1bar_temp2},
+                          {&p0_old, &p0_new});
 
             // compute gamma1bar^{nph,*} and store it in gamma1bar_temp2
             for(int i=0; i<gamma1bar_temp2.size(); ++i) {
@@ -502,8 +515,10 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
         }
 
         // base state enthalpy update
-        // compute rhoh0_old by "averaging"
-        Average(s1, rhoh0_old, RhoH);
+        // compute rhoh0_old by "averaging", unless it was done with rho0_new
+        if (!use_etarho) {
+            Average(s1, rhoh0_old, RhoH);
+        }
 
         base_time_start = ParallelDescriptor::second();
 
@@ -518,6 +533,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
         p0_new = p0_old;
     }
 
+    TimingLedgerMark("step4:enthalpy_advance");
+
     if (maestro_verbose >= 1) {
         Print() << "            : enthalpy_advance >>>" << std::endl;
     }
@@ -540,6 +557,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
 
     thermal_time_start = ParallelDescriptor::second();
 
+    TimingLedgerMark("step4a:thermal_conduct");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 4a: thermal conduct >>>" << std::endl;
     }
@@ -587,6 +606,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
 
     react_time_start = ParallelDescriptor::second();
 
+    TimingLedgerMark("step5:react_state");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 5 : react state >>>" << std::endl;
     }
@@ -629,6 +650,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
 
     advect_time_start = ParallelDescriptor::second();
 
+    TimingLedgerMark("step6:make_new_s_and_new_w0");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 6 : make new S and new w0 >>>" << std::endl;
     }
@@ -637,8 +660,6 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
         // reset cutoff coordinates to old time value
         compute_cutoff_coords(rho0_old.dataPtr());
         ComputeCutoffCoords(rho0_old);
-        BaseState<Real> rho0_state(rho0_old, base_geom.max_radial_level+1, base_geom.nr_fine);
-        base_geom.ComputeCutoffCoords(rho0_state.array());
     }
 
     if (use_thermal_diffusion) {
@@ -708,8 +729,6 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
         base_time_start = ParallelDescriptor::second();
 
         ComputeCutoffCoords(rho0_old);
-        BaseState<Real> rho0_state(rho0_old, base_geom.max_radial_level+1, base_geom.nr_fine);
-        base_geom.ComputeCutoffCoords(rho0_state.array());
 
         // compute w0, w0_force, and delta_chi_w0
         is_predictor = 0;
@@ -736,6 +755,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
     // STEP 7 -- redo the construction of the advective velocity using the current w0
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step7:create_mac_velocities");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 7 : create MAC velocities >>>" << std::endl;
     }
@@ -752,6 +773,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
     ParallelDescriptor::ReduceRealMax(advect_time,ParallelDescriptor::IOProcessorNumber());
     ParallelDescriptor::Bcast(&advect_time,1,ParallelDescriptor::IOProcessorNumber());
 
+    TimingLedgerMark("step7:mac_proj");
+
     macproj_time_start = ParallelDescriptor::second();
 
     // MAC projection
@@ -768,6 +791,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
 
     advect_time_start = ParallelDescriptor::second();
 
+    TimingLedgerMark("step8:advect_base");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 8 : advect base >>>" << std::endl;
     }
@@ -784,8 +809,6 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
 
         compute_cutoff_coords(rho0_new.dataPtr());
         ComputeCutoffCoords(rho0_new);
-        BaseState<Real> rho0_state(rho0_new, base_geom.max_radial_level+1, base_geom.nr_fine);
-        base_geom.ComputeCutoffCoords(rho0_state.array());
     }
 
     // copy temperature from s1 into s2 for seeding eos calls
@@ -794,6 +817,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
         MultiFab::Copy(s2[lev],s1[lev],Temp,Temp,1,ng_s);
     }
 
+    TimingLedgerMark("step8:density_advance");
+
     if (maestro_verbose >= 1) {
         Print() << "            :  density_advance >>>" << std::endl;
         Print() << "            :   tracer_advance >>>" << std::endl;
@@ -828,8 +853,6 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
             Average(s2, rho0_new, Rho);
             compute_cutoff_coords(rho0_new.dataPtr());
             ComputeCutoffCoords(rho0_new);
-            BaseState<Real> rho0_state(rho0_new, base_geom.max_radial_level+1, base_geom.nr_fine);
-            base_geom.ComputeCutoffCoords(rho0_state.array());
         }
 
         // update grav_cell_new, rho0_nph, grav_cell_nph
@@ -897,6 +920,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
         grav_cell_nph = grav_cell_old;
     }
 
+    TimingLedgerMark("step8:enthalpy_advance");
+
     if (maestro_verbose >= 1) {
         Print() << "            : enthalpy_advance >>>" << std::endl;
     }
@@ -919,6 +944,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
 
     thermal_time_start = ParallelDescriptor::second();
 
+    TimingLedgerMark("step8a:thermal_conduct");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 8a: thermal conduct >>>" << std::endl;
     }
@@ -960,6 +987,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
 
     react_time_start = ParallelDescriptor::second();
 
+    TimingLedgerMark("step9:react_state");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 9 : react state >>>" << std::endl;
     }
@@ -999,6 +1028,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
 
     ndproj_time_start = ParallelDescriptor::second();
 
+    TimingLedgerMark("step10:make_new_s");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 10: make new S >>>" << std::endl;
     }
@@ -1040,6 +1071,8 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
 
     advect_time_start = ParallelDescriptor::second();
 
+    TimingLedgerMark("step11:update_and_project_new_velocity");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 11: update and project new velocity >>>" << std::endl;
     }
@@ -1062,10 +1095,15 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
 
     int proj_type;
 
+    // whether tempbar was averaged together with peosbar
+    bool tempbar_done = false;
+
     advect_time += ParallelDescriptor::second() - advect_time_start;
     ParallelDescriptor::ReduceRealMax(advect_time,ParallelDescriptor::IOProcessorNumber());
     ParallelDescriptor::Bcast(&advect_time,1,ParallelDescriptor::IOProcessorNumber());
 
+    TimingLedgerMark("step11:nodal_proj");
+
     ndproj_time_start = ParallelDescriptor::second();
 
     // Project the new velocity field
@@ -1102,8 +1140,15 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
             // peos_new now holds the thermodynamic p computed from snew(rho h X)
             PfromRhoH(snew,snew,delta_p_term);
 
-            // compute peosbar = Avg(peos_new)
-            Average(delta_p_term,peosbar,0);
+            // compute peosbar = Avg(peos_new), and tempbar (needed at the
+            // end of the step, snew's temperature is final here) in the
+            // same reduction
+            if (!is_initIter && !fix_base_state) {
+                Average({&delta_p_term, &snew}, {&peosbar, &tempbar}, {0, Temp});
+                tempbar_done = true;
+            } else {
+                Average(delta_p_term,peosbar,0);
+            }
 
             // no need to compute p0_minus_peosbar since make_w0 is not called after here
 
@@ -1131,11 +1176,16 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
 
     misc_time_start = ParallelDescriptor::second();
 
+    TimingLedgerMark("finalize:average");
+
     if (!is_initIter) {
-        if (!fix_base_state) {
+        if (!fix_base_state && !tempbar_done) {
             // compute tempbar by "averaging"
             Average(snew,tempbar,Temp);
         }
+
+        // keep the reaction terms for the runtime diagnostics
+        SaveDiagReactTerms(rho_Hext,rho_omegadot,rho_Hnuc);
     }
 
     Print() << "\nTimestep " << istep << " ends with TIME = " << t_new
@@ -1158,4 +1208,40 @@ Maestro::AdvanceTimeStep (bool is_initIter) {
         Print() << "Misc       :" << misc_time << " seconds\n";
         Print() << "Base State :" << base_time << " seconds\n";
     }
+
+    // return the temporaries to the scratch pool for the next time step
+    ScratchFree(rhohalf);
+    ScratchFree(macrhs);
+    ScratchFree(macphi);
+    ScratchFree(S_cc_nph);
+    ScratchFree(rho_omegadot);
+    ScratchFree(thermal1);
+    ScratchFree(thermal2);
+    ScratchFree(rho_Hnuc);
+    ScratchFree(rho_Hext);
+    ScratchFree(s1);
+    ScratchFree(s2);
+    ScratchFree(s2star);
+    ScratchFree(delta_gamma1_term);
+    ScratchFree(delta_gamma1);
+    ScratchFree(peosbar_cart);
+    ScratchFree(delta_p_term);
+    ScratchFree(Tcoeff);
+    ScratchFree(hcoeff1);
+    ScratchFree(Xkcoeff1);
+    ScratchFree(pcoeff1);
+    ScratchFree(hcoeff2);
+    ScratchFree(Xkcoeff2);
+    ScratchFree(pcoeff2);
+    ScratchFree(scal_force);
+    ScratchFree(delta_chi);
+    ScratchFree(sponge);
+    ScratchFree(etarhoflux);
+    ScratchFree(umac);
+    ScratchFree(sedge);
+    ScratchFree(sflux);
+    ScratchFree(w0_force_cart);
+    ScratchFree(w0mac);
+
+    TimingLedgerEnd("AdvanceTimeStep", is_initIter);
 }
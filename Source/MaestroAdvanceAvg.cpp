@@ -11,6 +11,10 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::AdvanceTimeStepAverage()",AdvanceTimeStepAverage);
 
+    // reset the per-step timing ledger
+    TimingLedgerBegin();
+    TimingLedgerMark("setup:allocate");
+
     // cell-centered MultiFabs needed within the AdvanceTimeStep routine
     Vector<MultiFab>      rhohalf(finest_level+1);
     Vector<MultiFab>       macrhs(finest_level+1);
@@ -212,6 +216,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
     // STEP 1 -- react the full state and then base state through dt/2
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step1:react_state");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 1 : react state >>>" << std::endl;
     }
@@ -229,6 +235,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
     // STEP 2 -- define average expansion at time n+1/2
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step2:compute_provisional_s");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 2 : compute provisional S >>>" << std::endl;
     }
@@ -309,6 +317,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
     // STEP 3 -- construct the advective velocity
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step3:create_mac_velocities");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 3 : create MAC velocities >>>" << std::endl;
     }
@@ -338,6 +348,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
         Addw0(umac,w0mac,-1.);
     }
 
+    TimingLedgerMark("step3:mac_proj");
+
     // wallclock time
     Real start_total_macproj = ParallelDescriptor::second();
 
@@ -358,6 +370,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
     // STEP 4 -- advect the full state through dt
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step4:advect_base");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 4 : advect base >>>" << std::endl;
     }
@@ -385,6 +399,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
         MultiFab::Copy(s2[lev],s1[lev],Temp,Temp,1,ng_s);
     }
 
+    TimingLedgerMark("step4:density_advance");
+
     if (maestro_verbose >= 1) {
         Print() << "            :  density_advance >>>" << std::endl;
         Print() << "            :   tracer_advance >>>" << std::endl;
@@ -441,14 +457,15 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
 
     // base state enthalpy update
     if (evolve_base_state) {
-        // compute rhoh0_old by "averaging"
-        Average(s1, rhoh0_old, RhoH);
-        Average(s2, rhoh0_new, RhoH); // -> rhoh0_new = rhoh0_old (bad?)
+        // compute rhoh0_old and rhoh0_new by "averaging"
+        Average({&s1, &s2}, {&rhoh0_old, &rhoh0_new}, {RhoH, RhoH});
     }
     else {
         rhoh0_new = rhoh0_old;
     }
 
+    TimingLedgerMark("step4:enthalpy_advance");
+
     if (maestro_verbose >= 1) {
         Print() << "            : enthalpy_advance >>>" << std::endl;
     }
@@ -468,6 +485,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
     // STEP 4a (Option I) -- Add thermal conduction (only enthalpy terms)
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step4a:thermal_conduct");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 4a: thermal conduct >>>" << std::endl;
     }
@@ -503,6 +522,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
     // STEP 5 -- react the full state and then base state through dt/2
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step5:react_state");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 5 : react state >>>" << std::endl;
     }
@@ -537,6 +558,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
     // STEP 6 -- define a new average expansion rate at n+1/2
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step6:make_new_s");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 6 : make new S >>>" << std::endl;
     }
@@ -632,6 +655,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
     // STEP 7 -- redo the construction of the advective velocity
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step7:create_mac_velocities");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 7 : create MAC velocities >>>" << std::endl;
     }
@@ -655,6 +680,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
         Addw0(umac,w0mac,-1.);
     }
 
+    TimingLedgerMark("step7:mac_proj");
+
     // wallclock time
     start_total_macproj = ParallelDescriptor::second();
 
@@ -675,6 +702,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
     // STEP 8 -- advect the full state through dt
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step8:advect_base");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 8 : advect base >>>" << std::endl;
     }
@@ -688,6 +717,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
         MultiFab::Copy(s2[lev],s1[lev],Temp,Temp,1,ng_s);
     }
 
+    TimingLedgerMark("step8:density_advance");
+
     if (maestro_verbose >= 1) {
         Print() << "            :  density_advance >>>" << std::endl;
         Print() << "            :   tracer_advance >>>" << std::endl;
@@ -745,6 +776,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
     }
 
     // base state enthalpy update
+    TimingLedgerMark("step8:enthalpy_advance");
+
     if (maestro_verbose >= 1) {
         Print() << "            : enthalpy_advance >>>" << std::endl;
     }
@@ -764,6 +797,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
     // STEP 8a (Option I) -- Add thermal conduction (only enthalpy terms)
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step8a:thermal_conduct");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 8a: thermal conduct >>>" << std::endl;
     }
@@ -793,6 +828,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
     // STEP 9 -- react the full state and then base state through dt/2
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step9:react_state");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 9 : react state >>>" << std::endl;
     }
@@ -819,6 +856,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
     // STEP 10 -- compute S^{n+1} for the final projection
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step10:make_new_s");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 10: make new S >>>" << std::endl;
     }
@@ -868,6 +907,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
     // STEP 11 -- update the velocity
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step11:update_and_project_new_velocity");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 11: update and project new velocity >>>" << std::endl;
     }
@@ -949,6 +990,8 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
         }
     }
 
+    TimingLedgerMark("step11:nodal_proj");
+
     // wallclock time
     const Real start_total_nodalproj = ParallelDescriptor::second();
 
@@ -970,11 +1013,16 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
 
     beta0_nm1.copy(0.5*(beta0_old + beta0_new));
 
+    TimingLedgerMark("finalize:average");
+
     if (!is_initIter) {
         if (!fix_base_state) {
             // compute tempbar by "averaging"
             Average(snew,tempbar,Temp);
         }
+
+        // keep the reaction terms for the runtime diagnostics
+        SaveDiagReactTerms(rho_Hext,rho_omegadot,rho_Hnuc);
     }
 
     Print() << "\nTimestep " << istep << " ends with TIME = " << t_new
@@ -987,4 +1035,5 @@ Maestro::AdvanceTimeStepAverage (bool is_initIter) {
         Print() << "Time to solve reactions  : " << end_total_react << '\n';
     }
 
+    TimingLedgerEnd("AdvanceTimeStepAverage", is_initIter);
 }
@@ -11,6 +11,10 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::AdvanceTimeStepIrreg()",AdvanceTimeStepIrreg);
 
+    // reset the per-step timing ledger
+    TimingLedgerBegin();
+    TimingLedgerMark("setup:allocate");
+
     // cell-centered MultiFabs needed within the AdvanceTimeStep routine
     Vector<MultiFab>      rhohalf(finest_level+1);
     Vector<MultiFab>       macrhs(finest_level+1);
@@ -210,6 +214,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
     // STEP 1 -- react the full state and then base state through dt/2
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step1:react_state");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 1 : react state >>>" << std::endl;
     }
@@ -227,6 +233,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
     // STEP 2 -- define average expansion at time n+1/2
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step2:compute_provisional_s");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 2 : compute provisional S >>>" << std::endl;
     }
@@ -308,6 +316,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
     // STEP 3 -- construct the advective velocity
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step3:create_mac_velocities");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 3 : create MAC velocities >>>" << std::endl;
     }
@@ -331,6 +341,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
         Addw0(umac,w0mac,-1.);
     }
 
+    TimingLedgerMark("step3:mac_proj");
+
     // wallclock time
     Real start_total_macproj = ParallelDescriptor::second();
 
@@ -351,6 +363,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
     // STEP 4 -- advect the full state through dt
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step4:advect_base");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 4 : advect base >>>" << std::endl;
     }
@@ -378,6 +392,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
         MultiFab::Copy(s2[lev],s1[lev],Temp,Temp,1,ng_s);
     }
 
+    TimingLedgerMark("step4:density_advance");
+
     if (maestro_verbose >= 1) {
         Print() << "            :  density_advance >>>" << std::endl;
         Print() << "            :   tracer_advance >>>" << std::endl;
@@ -434,14 +450,15 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
 
     // base state enthalpy update
     if (evolve_base_state) {
-        // compute rhoh0_old by "averaging"
-        Average(s1, rhoh0_old, RhoH);
-        Average(s2, rhoh0_new, RhoH); // -> rhoh0_new = rhoh0_old (bad?)
+        // compute rhoh0_old and rhoh0_new by "averaging"
+        Average({&s1, &s2}, {&rhoh0_old, &rhoh0_new}, {RhoH, RhoH});
     }
     else {
         rhoh0_new = rhoh0_old;
     }
 
+    TimingLedgerMark("step4:enthalpy_advance");
+
     if (maestro_verbose >= 1) {
         Print() << "            : enthalpy_advance >>>" << std::endl;
     }
@@ -457,6 +474,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
     // STEP 4a (Option I) -- Add thermal conduction (only enthalpy terms)
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step4a:thermal_conduct");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 4a: thermal conduct >>>" << std::endl;
     }
@@ -492,6 +511,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
     // STEP 5 -- react the full state and then base state through dt/2
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step5:react_state");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 5 : react state >>>" << std::endl;
     }
@@ -527,6 +548,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
     // STEP 6 -- define a new average expansion rate at n+1/2
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step6:make_new_s");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 6 : make new S >>>" << std::endl;
     }
@@ -619,6 +642,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
     // STEP 7 -- redo the construction of the advective velocity
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step7:create_mac_velocities");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 7 : create MAC velocities >>>" << std::endl;
     }
@@ -636,6 +661,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
         Addw0(umac,w0mac,-1.);
     }
 
+    TimingLedgerMark("step7:mac_proj");
+
     // wallclock time
     start_total_macproj = ParallelDescriptor::second();
 
@@ -656,6 +683,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
     // STEP 8 -- advect the full state through dt
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step8:advect_base");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 8 : advect base >>>" << std::endl;
     }
@@ -669,6 +698,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
         MultiFab::Copy(s2[lev],s1[lev],Temp,Temp,1,ng_s);
     }
 
+    TimingLedgerMark("step8:density_advance");
+
     if (maestro_verbose >= 1) {
         Print() << "            :  density_advance >>>" << std::endl;
         Print() << "            :   tracer_advance >>>" << std::endl;
@@ -727,6 +758,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
     }
 
     // base state enthalpy update
+    TimingLedgerMark("step8:enthalpy_advance");
+
     if (maestro_verbose >= 1) {
         Print() << "            : enthalpy_advance >>>" << std::endl;
     }
@@ -742,6 +775,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
     // STEP 8a (Option I) -- Add thermal conduction (only enthalpy terms)
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step8a:thermal_conduct");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 8a: thermal conduct >>>" << std::endl;
     }
@@ -771,6 +806,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
     // STEP 9 -- react the full state and then base state through dt/2
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step9:react_state");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 9 : react state >>>" << std::endl;
     }
@@ -798,6 +835,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
     // STEP 10 -- compute S^{n+1} for the final projection
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step10:make_new_s");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 10: make new S >>>" << std::endl;
     }
@@ -841,6 +880,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
     // STEP 11 -- update the velocity
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step11:update_and_project_new_velocity");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 11: update and project new velocity >>>" << std::endl;
     }
@@ -917,6 +958,8 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
         }
     }
 
+    TimingLedgerMark("step11:nodal_proj");
+
     // wallclock time
     const Real start_total_nodalproj = ParallelDescriptor::second();
 
@@ -938,12 +981,17 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
 
     beta0_nm1.copy(0.5*(beta0_old + beta0_new));
 
+    TimingLedgerMark("finalize:average");
+
     if (!is_initIter) {
         if (!fix_base_state) {
             // compute tempbar by "averaging"
             Average(snew,tempbar,Temp);
         }
 
+        // keep the reaction terms for the runtime diagnostics
+        SaveDiagReactTerms(rho_Hext,rho_omegadot,rho_Hnuc);
+
         // output any runtime diagnostics
         // pass in the new time value, time+dt
         // call diag(time+dt,dt,dx,snew,rho_Hnuc2,rho_Hext,thermal2,rho_omegadot2,&
@@ -963,4 +1011,5 @@ Maestro::AdvanceTimeStepIrreg (bool is_initIter) {
         Print() << "Time to solve reactions  : " << end_total_react << '\n';
     }
 
+    TimingLedgerEnd("AdvanceTimeStepIrreg", is_initIter);
 }
@@ -11,6 +11,10 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::AdvanceTimeStepSDC()",AdvanceTimeStepSDC);
 
+    // reset the per-step timing ledger
+    TimingLedgerBegin();
+    TimingLedgerMark("setup:allocate");
+
     // cell-centered MultiFabs needed within the AdvanceTimeStep routine
     Vector<MultiFab>           shat(finest_level+1);
     Vector<MultiFab>        rhohalf(finest_level+1);
@@ -239,6 +243,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
     // STEP 1 -- Compute advection velocities
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step1:compute_advection_velocities");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 1 : Compute advection velocities >>>" << std::endl;
     }
@@ -338,6 +344,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
         Addw0(umac,w0mac,-1.);
     }
 
+    TimingLedgerMark("step1:mac_proj");
+
     // wallclock time
     Real start_total_macproj = ParallelDescriptor::second();
 
@@ -368,6 +376,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
     // STEP 2A -- compute advective flux divergences
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step2a:compute_advective_flux_div");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 2A : compute advective flux div >>>" << std::endl;
     }
@@ -396,6 +406,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
         MultiFab::Copy(shat[lev],sold[lev],0,0,Nscal,0);
     }
 
+    TimingLedgerMark("step2a:density_advance");
+
     if (maestro_verbose >= 1) {
         Print() << "            :  density_advance >>>" << std::endl;
     }
@@ -462,6 +474,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
         rhoh0_new = rhoh0_old;
     }
 
+    TimingLedgerMark("step2a:enthalpy_advance");
+
     if (maestro_verbose >= 1) {
         Print() << "            : enthalpy_advance >>>" << std::endl;
     }
@@ -489,6 +503,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
     // STEP 2B (optional) -- compute diffusive flux divergence
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step2b:compute_diffusive_flux_div");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 2B : compute diffusive flux div >>>" << std::endl;
     }
@@ -507,6 +523,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
     // STEP 2C -- advance thermodynamic variables
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step2c:advance_thermo_variables");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 2C : advance thermo variables >>>" << std::endl;
     }
@@ -519,6 +537,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
         MultiFab::Add(sdc_source[lev],aofs[lev],RhoH,RhoH,1,0);
     }
     
+    TimingLedgerMark("step2c:react");
+
     // wallclock time
     Real start_total_react = ParallelDescriptor::second();
     
@@ -528,6 +548,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
     Real end_total_react = ParallelDescriptor::second() - start_total_react;
     ParallelDescriptor::ReduceRealMax(end_total_react,ParallelDescriptor::IOProcessorNumber());
 
+    TimingLedgerMark("step2c:advance_thermo_variables");
+
     // extract IR =  [ (snew - sold)/dt - sdc_source ]
 
     for (int lev=0; lev<=finest_level; ++lev) {
@@ -694,6 +716,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
         //////////////////////////////////////////////////////////////////////////////
 
         if (sdc_couple_mac_velocity) {
+            TimingLedgerMark("step3:update_advection_velocities");
+
             if (maestro_verbose >= 1) {
                 Print() << "<<< STEP 3 : Update advection velocities (MISDC iter = " 
                         << misdc << ") >>>" << std::endl;
@@ -800,6 +824,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
                 Addw0(umac,w0mac,-1.);
             }
 
+            TimingLedgerMark("step3:mac_proj");
+
             // wallclock time
             Real start_total_macproj_corrector = ParallelDescriptor::second();
 
@@ -823,6 +849,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
     // STEP 4A -- compute advective flux divergences
     //////////////////////////////////////////////////////////////////////////////
 
+        TimingLedgerMark("step4a:compute_advective_flux_div");
+
         if (maestro_verbose >= 1) {
             Print() << "<<< STEP 4 : Corrector loop (MISDC iter = " 
                     << misdc << ") >>>" << std::endl;
@@ -833,6 +861,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
         // no need to advect the base state density
         rho0_new = rho0_old;
         
+        TimingLedgerMark("step4a:density_advance");
+
         if (maestro_verbose >= 1) {
             Print() << "            :  density_advance >>>" << std::endl;
         }
@@ -884,6 +914,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
         }
         
         // enthalpy update
+        TimingLedgerMark("step4a:enthalpy_advance");
+
         if (maestro_verbose >= 1) {
             Print() << "            : enthalpy_advance >>>" << std::endl;
         }
@@ -911,6 +943,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
     // STEP 4B (optional) -- compute diffusive flux divergences
     //////////////////////////////////////////////////////////////////////////////
 
+        TimingLedgerMark("step4b:compute_diffusive_flux_div");
+
         if (maestro_verbose >= 1) {
             Print() << "<<< STEP 4B : compute diffusive flux div (SDC iter = " 
                     << misdc << ") >>>" << std::endl;
@@ -941,6 +975,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
     // STEP 4C -- advance thermodynamic variables
     //////////////////////////////////////////////////////////////////////////////
 
+        TimingLedgerMark("step4c:advance_thermo_variables");
+
         if (maestro_verbose >= 1) {
             Print() << "<<< STEP 4C: advance thermo variables (MISDC iter = " 
                     << misdc << ") >>>" << std::endl;
@@ -957,6 +993,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
             MultiFab::Add(sdc_source[lev],aofs[lev],0,0,Nscal,0);
         }
     
+        TimingLedgerMark("step4c:react");
+
         // wallclock time
         Real start_total_react_corrector = ParallelDescriptor::second();
     
@@ -966,6 +1004,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
         Real end_total_react_corrector = ParallelDescriptor::second() - start_total_react_corrector;
         ParallelDescriptor::ReduceRealMax(end_total_react_corrector,ParallelDescriptor::IOProcessorNumber());
 
+        TimingLedgerMark("step4c:advance_thermo_variables");
+
         // extract IR =  [ (snew - sold)/dt - sdc_source ]
         for (int lev=0; lev<=finest_level; ++lev) {
             intra[lev].setVal(0.);
@@ -1133,6 +1173,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
     // STEP 5 -- Advance velocity and dynamic pressure
     //////////////////////////////////////////////////////////////////////////////
 
+    TimingLedgerMark("step5:advance_velocity_and_dynamic_pressure");
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 5 : Advance velocity and dynamic pressure >>>" << std::endl;
     }
@@ -1254,6 +1296,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
         }
     }
 
+    TimingLedgerMark("step5:nodal_proj");
+
     // wallclock time
     const Real start_total_nodalproj = ParallelDescriptor::second();
 
@@ -1275,11 +1319,16 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
 
     beta0_nm1.copy(0.5*(beta0_old + beta0_new));
 
+    TimingLedgerMark("finalize:average");
+
     if (!is_initIter) {
         if (!fix_base_state) {
             // compute tempbar by "averaging"
             Average(snew,tempbar,Temp);
         }
+
+        // keep the reaction terms for the runtime diagnostics
+        SaveDiagReactTerms(rho_Hext,rho_omegadot,rho_Hnuc);
     }
 
     Print() << "\nTimestep " << istep << " ends with TIME = " << t_new
@@ -1292,4 +1341,5 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
         Print() << "Time to solve reactions  : " << end_total_react << '\n';
     }
 
+    TimingLedgerEnd("AdvanceTimeStepSDC", is_initIter);
 }
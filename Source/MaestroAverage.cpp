@@ -11,13 +11,31 @@ using namespace amrex;
 void Maestro::Average (const Vector<MultiFab>& phi,
                        RealVector& phibar,
                        int comp)
+{
+    Average({&phi}, {&phibar}, {comp});
+}
+
+// Average a batch of quantities, phi_batch[ib] component comp_batch[ib]
+// into phibar_batch[ib].  The radial sums of the whole batch are
+// accumulated locally into one packed buffer and reduced across ranks
+// together, so the batch costs a single collective.
+
+void Maestro::Average (const Vector<const Vector<MultiFab>*>& phi_batch,
+                       const Vector<RealVector*>& phibar_batch,
+                       const Vector<int>& comp_batch)
 {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::Average()",Average);
 
+    AMREX_ASSERT(phi_batch.size() == phibar_batch.size());
+    AMREX_ASSERT(phi_batch.size() == comp_batch.size());
+
     const int max_lev = base_geom.max_radial_level+1;
-    
-    std::fill(phibar.begin(), phibar.end(), 0.0);
+    const int nbatch = phi_batch.size();
+
+    for (int ib = 0; ib < nbatch; ++ib) {
+        std::fill(phibar_batch[ib]->begin(), phibar_batch[ib]->end(), 0.0);
+    }
 
     if (spherical == 0) {
 
@@ -25,9 +43,10 @@ void Maestro::Average (const Vector<MultiFab>& phi,
 
         // phibar is dimensioned to "base_geom.max_radial_level" so we must mimic that for phisum
         // so we can simply swap this result with phibar
-        RealVector phisum((base_geom.max_radial_level+1)*base_geom.nr_fine, 0.0);
-        phisum.shrink_to_fit();
-        Real * AMREX_RESTRICT phisum_p = phisum.dataPtr();
+        const int nsum = (base_geom.max_radial_level+1)*base_geom.nr_fine;
+
+        // the sums of the whole batch, one quantity after another
+        RealVector phisum_batch(nbatch*nsum, 0.0);
 
         // this stores how many cells there are laterally at each level
         IntVector ncell(base_geom.max_radial_level+1);
@@ -46,118 +65,196 @@ void Maestro::Average (const Vector<MultiFab>& phi,
                 ncell[lev] = (domainBox.bigEnd(0)+1)*(domainBox.bigEnd(1)+1);
             }
 
-            // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
-#ifdef _OPENMP
-#pragma omp parallel if (!system::regtest_reduction)
-#endif
-            for ( MFIter mfi(phi[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi )
-            {
-                // Get the index space of the valid region
-                const Box& tilebox = mfi.tilebox();
+            for (int ib = 0; ib < nbatch; ++ib) {
+
+                const MultiFab& phi_mf = (*phi_batch[ib])[lev];
+                const int comp = comp_batch[ib];
+                Real * AMREX_RESTRICT phisum_p = phisum_batch.dataPtr() + ib*nsum;
 
-                const Array4<const Real> phi_arr = phi[lev].array(mfi, comp);
+                if (Gpu::inLaunchRegion()) {
 
-                AMREX_PARALLEL_FOR_3D(tilebox, i, j, k, {
-                    int r = AMREX_SPACEDIM == 2 ? j : k;
+                    // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+                    for ( MFIter mfi(phi_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi )
+                    {
+                        // Get the index space of the valid region
+                        const Box& tilebox = mfi.tilebox();
+
+                        const Array4<const Real> phi_arr = phi_mf.array(mfi, comp);
+
+                        AMREX_PARALLEL_FOR_3D(tilebox, i, j, k, {
+                            int r = AMREX_SPACEDIM == 2 ? j : k;
 #if (AMREX_SPACEDIM == 2)
-                    if (k == 0)
+                            if (k == 0)
+#endif
+                                amrex::HostDevice::Atomic::Add(&(phisum_p[lev+max_lev*r]), phi_arr(i, j, k));
+                        });
+                    }
+
+                } else {
+
+                    // each tile sums into its own bins, which are then merged
+                    // in a fixed order, so no atomics are needed and the
+                    // result does not depend on the number of threads
+                    TileBinSum<Real> tile_sum(phi_mf, TilingIfNotGPU());
+
+                    // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
 #endif
-                        amrex::HostDevice::Atomic::Add(&(phisum_p[lev+max_lev*r]), phi_arr(i, j, k));
-                });
+                    for ( MFIter mfi(phi_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi )
+                    {
+                        // Get the index space of the valid region
+                        const Box& tilebox = mfi.tilebox();
+                        const auto lo = amrex::lbound(tilebox);
+                        const auto hi = amrex::ubound(tilebox);
+
+                        const Array4<const Real> phi_arr = phi_mf.array(mfi, comp);
+
+                        const int r_lo = tilebox.smallEnd(AMREX_SPACEDIM-1);
+                        const int r_hi = tilebox.bigEnd(AMREX_SPACEDIM-1);
+                        Real* bin = tile_sum.Tile(mfi.LocalTileIndex(), r_lo, r_hi);
+
+                        for (int k = lo.z; k <= hi.z; ++k) {
+                            for (int j = lo.y; j <= hi.y; ++j) {
+                                const int r = AMREX_SPACEDIM == 2 ? j : k;
+                                for (int i = lo.x; i <= hi.x; ++i) {
+                                    bin[r-r_lo] += phi_arr(i,j,k);
+                                }
+                            }
+                        }
+                    }
+
+                    tile_sum.Merge(phisum_p, lev, max_lev);
+                }
             }
         }
         
         // reduction over boxes to get sum
-        ParallelDescriptor::ReduceRealSum(phisum.dataPtr(),(base_geom.max_radial_level+1)*base_geom.nr_fine);
-
-        // divide phisum by ncell so it stores "phibar"
-        for (int lev = 0; lev < max_lev; ++lev) {
-            for (auto i = 1; i <= base_geom.numdisjointchunks(lev); ++i) { 
-                const int lo = base_geom.r_start_coord(lev,i);
-                const int hi = base_geom.r_end_coord(lev,i);
-                Real ncell_lev = ncell[lev];
-                AMREX_PARALLEL_FOR_1D(hi-lo+1, j, {
-                    int r = j + lo;
-                    phisum_p[lev+max_lev*r] /= ncell_lev;
-                });
+        ParallelReduceSum(phisum_batch.dataPtr(), nbatch*nsum);
+
+        for (int ib = 0; ib < nbatch; ++ib) {
+
+            RealVector phisum(phisum_batch.begin() + ib*nsum,
+                              phisum_batch.begin() + (ib+1)*nsum);
+            Real * AMREX_RESTRICT phisum_p = phisum.dataPtr();
+
+            // divide phisum by ncell so it stores "phibar"
+            for (int lev = 0; lev < max_lev; ++lev) {
+                for (auto i = 1; i <= base_geom.numdisjointchunks(lev); ++i) { 
+                    const int lo = base_geom.r_start_coord(lev,i);
+                    const int hi = base_geom.r_end_coord(lev,i);
+                    Real ncell_lev = ncell[lev];
+                    AMREX_PARALLEL_FOR_1D(hi-lo+1, j, {
+                        int r = j + lo;
+                        phisum_p[lev+max_lev*r] /= ncell_lev;
+                    });
+                }
             }
-        }
 
-        RestrictBase(phisum, true);
-        FillGhostBase(phisum, true);
+            RestrictBase(phisum, true);
+            FillGhostBase(phisum, true);
 
-        // swap pointers so phibar contains the computed average
-        std::swap(phisum,phibar);
+            // swap pointers so phibar contains the computed average
+            std::swap(phisum,*phibar_batch[ib]);
+        }
 
     } else if (spherical == 1 && use_exact_base_state) {
         // spherical case with uneven base state spacing
 
         // phibar is dimensioned to "base_geom.max_radial_level" so we must mimic that for phisum
         // so we can simply swap this result with phibar
-        RealVector phisum((base_geom.max_radial_level+1)*base_geom.nr_fine,0.0);
+        const int nsum = (base_geom.max_radial_level+1)*base_geom.nr_fine;
 
-        // this stores how many cells there are at each level
-        Vector<int> ncell((base_geom.max_radial_level+1)*base_geom.nr_fine,0);
+        // the sums of the whole batch, one quantity after another, followed
+        // by the cell counts so that they are reduced together
+        RealVector phisum_batch((nbatch+1)*nsum,0.0);
+
+        // this stores how many cells there are at each level.  The counts
+        // do not depend on the quantity, so only the first one is kept
+        Vector<int> ncell(nsum,0);
+        Vector<int> ncell_unused(nsum,0);
 
         // loop is over the existing levels (up to finest_level)
         for (int lev=0; lev<=finest_level; ++lev) {
 
-            // get references to the MultiFabs at level lev
-            const MultiFab& phi_mf = phi[lev];
             const MultiFab& cc_to_r = cell_cc_to_r[lev];
 
-            // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
-            for (MFIter mfi(phi_mf); mfi.isValid(); ++mfi) {
+            for (int ib = 0; ib < nbatch; ++ib) {
+
+                // get references to the MultiFabs at level lev
+                const MultiFab& phi_mf = (*phi_batch[ib])[lev];
+                const int comp = comp_batch[ib];
+                int* ncell_p = (ib == 0) ? ncell.dataPtr() : ncell_unused.dataPtr();
 
-                // Get the index space of the valid region
-                const Box& validBox = mfi.validbox();
+                // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+                for (MFIter mfi(phi_mf); mfi.isValid(); ++mfi) {
 
-                // call fortran subroutine
-                // use macros in AMReX_ArrayLim.H to pass in each FAB's data,
-                // lo/hi coordinates (including ghost cells), and/or the # of components
-                // We will also pass "validBox", which specifies the "valid" region.
-                average_sphr_irreg(&lev, ARLIM_3D(validBox.loVect()), ARLIM_3D(validBox.hiVect()),
-                                   BL_TO_FORTRAN_N_3D(phi_mf[mfi],comp),
-                                   phisum.dataPtr(), ncell.dataPtr(),
-                                   BL_TO_FORTRAN_3D(cc_to_r[mfi]));
+                    // Get the index space of the valid region
+                    const Box& validBox = mfi.validbox();
+
+                    // call fortran subroutine
+                    // use macros in AMReX_ArrayLim.H to pass in each FAB's data,
+                    // lo/hi coordinates (including ghost cells), and/or the # of components
+                    // We will also pass "validBox", which specifies the "valid" region.
+                    average_sphr_irreg(&lev, ARLIM_3D(validBox.loVect()), ARLIM_3D(validBox.hiVect()),
+                                       BL_TO_FORTRAN_N_3D(phi_mf[mfi],comp),
+                                       phisum_batch.dataPtr() + ib*nsum, ncell_p,
+                                       BL_TO_FORTRAN_3D(cc_to_r[mfi]));
+                }
             }
         }
 
         // reduction over boxes to get sum
-        ParallelDescriptor::ReduceRealSum(phisum.dataPtr(),(base_geom.max_radial_level+1)*base_geom.nr_fine);
-        ParallelDescriptor::ReduceIntSum(ncell.dataPtr(),(base_geom.max_radial_level+1)*base_geom.nr_fine);
-
-        // divide phisum by ncell so it stores "phibar"
-        for (int lev = 0; lev < max_lev; ++lev) {
-            for (auto r = 0; r < base_geom.nr_fine; ++r) {
-                if (ncell[lev+max_lev*r] > 0) {
-                    phisum[lev+max_lev*r] /= ncell[lev+max_lev*r];
-                } else {
-                    // keep value constant if it is outside the cutoff coords
-                    phisum[lev+max_lev*r] = phisum[lev+max_lev*(r-1)];
-                }
-            }           
+        for (int i = 0; i < nsum; ++i) {
+            phisum_batch[nbatch*nsum+i] = ncell[i];
+        }
+        ParallelReduceSum(phisum_batch.dataPtr(), (nbatch+1)*nsum);
+        for (int i = 0; i < nsum; ++i) {
+            ncell[i] = static_cast<int>(phisum_batch[nbatch*nsum+i]);
         }
 
-        RestrictBase(phisum, true);
-        FillGhostBase(phisum, true);
+        for (int ib = 0; ib < nbatch; ++ib) {
 
-        // swap pointers so phibar contains the computed average
-        std::swap(phisum,phibar);
+            RealVector phisum(phisum_batch.begin() + ib*nsum,
+                              phisum_batch.begin() + (ib+1)*nsum);
+
+            // divide phisum by ncell so it stores "phibar"
+            for (int lev = 0; lev < max_lev; ++lev) {
+                for (auto r = 0; r < base_geom.nr_fine; ++r) {
+                    if (ncell[lev+max_lev*r] > 0) {
+                        phisum[lev+max_lev*r] /= ncell[lev+max_lev*r];
+                    } else {
+                        // keep value constant if it is outside the cutoff coords
+                        phisum[lev+max_lev*r] = phisum[lev+max_lev*(r-1)];
+                    }
+                }           
+            }
+
+            RestrictBase(phisum, true);
+            FillGhostBase(phisum, true);
+
+            // swap pointers so phibar contains the computed average
+            std::swap(phisum,*phibar_batch[ib]);
+        }
     } else {
         // spherical case with even base state spacing
 
         // For spherical, we construct a 1D array at each level, phisum, that has space
         // allocated for every possible radius that a cell-center at each level can
         // map into.  The radial locations have been precomputed and stored in radii.
-        RealVector phisum((finest_level+1)*(base_geom.nr_irreg+2), 0.0);
-        RealVector radii((finest_level+1)*(base_geom.nr_irreg+3));
-        IntVector ncell((finest_level+1)*(base_geom.nr_irreg+2), 0);
+        const int nsum = (finest_level+1)*(base_geom.nr_irreg+2);
+
+        // the sums of the whole batch, one quantity after another, followed
+        // by the cell counts so that they are reduced together
+        RealVector phisum_batch((nbatch+1)*nsum, 0.0);
+        RealVector radii_all((finest_level+1)*(base_geom.nr_irreg+3));
 
-        Real * AMREX_RESTRICT radii_p = radii.dataPtr();
-        Real * AMREX_RESTRICT phisum_p = phisum.dataPtr();
-        int * AMREX_RESTRICT ncell_p = ncell.dataPtr();
-        const auto center_p = center;
+        // the counts do not depend on the quantity, so only the first one
+        // is kept
+        IntVector ncell_all(nsum, 0);
+
+        Real * AMREX_RESTRICT radii_all_p = radii_all.dataPtr();
+        int * AMREX_RESTRICT ncell_all_p = ncell_all.dataPtr();
 
         const int fine_lev = finest_level + 1;
         const int nr_irreg = base_geom.nr_irreg;
@@ -170,232 +267,299 @@ void Maestro::Average (const Vector<MultiFab>& phi,
             const auto dx = geom[lev].CellSizeArray();
 
             AMREX_PARALLEL_FOR_1D(nr_irreg+1, r, {
-                radii_p[lev+fine_lev*(r+1)] = std::sqrt(0.75+2.0*Real(r)) * dx[0];
+                radii_all_p[lev+fine_lev*(r+1)] = std::sqrt(0.75+2.0*Real(r)) * dx[0];
             });
 
-            radii[lev+fine_lev*(nr_irreg+2)] = 1.e99;
-            radii[lev] = 0.0;
+            radii_all[lev+fine_lev*(nr_irreg+2)] = 1.e99;
+            radii_all[lev] = 0.0;
         }
 
         // loop is over the existing levels (up to finest_level)
         for (int lev=finest_level; lev>=0; --lev) {
 
-            // Get the grid size of the domain
-            const auto dx = geom[lev].CellSizeArray();
-            const auto prob_lo = geom[lev].ProbLoArray();
-
-            // get references to the MultiFabs at level lev
-            const MultiFab& phi_mf = phi[lev];
-
             // create mask assuming refinement ratio = 2
             int finelev = lev+1;
             if (lev == finest_level) finelev = finest_level;
 
-            const BoxArray& fba = phi[finelev].boxArray();
-            const iMultiFab& mask = makeFineMask(phi_mf, fba, IntVect(2));
+            const MultiFab& phi0_mf = (*phi_batch[0])[lev];
+            const BoxArray& fba = (*phi_batch[0])[finelev].boxArray();
+            const iMultiFab& mask = makeFineMask(phi0_mf, fba, IntVect(2));
 
-            // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
-#ifdef _OPENMP
-#pragma omp parallel if (!system::regtest_reduction)
-#endif
-            for ( MFIter mfi(phi_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
-                // Get the index space of the valid region
-                const Box& tilebox = mfi.tilebox();
+            bool use_mask = !(lev==fine_lev-1);
+
+            for (int ib = 0; ib < nbatch; ++ib) {
 
-                const Array4<const int> mask_arr = mask.array(mfi);
-                const Array4<const Real> phi_arr = phi[lev].array(mfi, comp);
+                // get references to the MultiFabs at level lev
+                const MultiFab& phi_mf = (*phi_batch[ib])[lev];
+                const int comp = comp_batch[ib];
+                Real * AMREX_RESTRICT phisum_p = phisum_batch.dataPtr() + ib*nsum;
+                const bool count_cells = (ib == 0);
 
-                bool use_mask = !(lev==fine_lev-1);
+                if (Gpu::inLaunchRegion()) {
 
-                AMREX_PARALLEL_FOR_3D(tilebox, i, j, k, {
-                    Real x = prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                    Real y = prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                    Real z = prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
+                    // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+                    for ( MFIter mfi(phi_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
+                        // Get the index space of the valid region
+                        const Box& tilebox = mfi.tilebox();
 
-                    // make sure the cell isn't covered by finer cells
-                    bool cell_valid = true;
-                    if (use_mask) {
-                        if (mask_arr(i,j,k) == 1) cell_valid = false;
+                        const Array4<const int> mask_arr = mask.array(mfi);
+                        const Array4<const Real> phi_arr = phi_mf.array(mfi, comp);
+
+                        // the radii index each cell center maps into, see MakeRadialMap
+                        const Array4<const int> irreg_r_arr = cell_irreg_r[lev].array(mfi);
+
+                        AMREX_PARALLEL_FOR_3D(tilebox, i, j, k, {
+                            // make sure the cell isn't covered by finer cells
+                            bool cell_valid = true;
+                            if (use_mask) {
+                                if (mask_arr(i,j,k) == 1) cell_valid = false;
+                            }
+
+                            if (cell_valid) {
+                                const int index = irreg_r_arr(i,j,k);
+
+                                amrex::HostDevice::Atomic::Add(&(phisum_p[lev+fine_lev*(index+1)]), phi_arr(i,j,k));
+                                if (count_cells) amrex::HostDevice::Atomic::Add(&(ncell_all_p[lev+fine_lev*(index+1)]), 1);
+                            }
+                        });
                     }
 
-                    if (cell_valid) {
-                        // compute distance to center
-                        Real radius = sqrt(x*x + y*y + z*z);
+                } else {
 
-                        // figure out which radii index this point maps into
-                        int index = std::round( ((radius/dx[0])*(radius/dx[0]) - 0.75) / 2.0 );
+                    // each tile sums into its own bins, which are then merged
+                    // in a fixed order, so no atomics are needed and the
+                    // result does not depend on the number of threads
+                    TileBinSum<Real> tile_sum(phi_mf, TilingIfNotGPU());
+                    TileBinSum<int> tile_count(phi_mf, TilingIfNotGPU());
 
-                        // due to roundoff error, need to ensure that we are in the proper radial bin
-                        if (index < nr_irreg) {
-                            if (fabs(radius-radii_p[lev+fine_lev*(index+1)]) > fabs(radius-radii_p[lev+fine_lev*(index+2)])) {
-                                index++;
+                    // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+                    for ( MFIter mfi(phi_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
+                        // Get the index space of the valid region
+                        const Box& tilebox = mfi.tilebox();
+                        const auto lo = amrex::lbound(tilebox);
+                        const auto hi = amrex::ubound(tilebox);
+
+                        const Array4<const int> mask_arr = mask.array(mfi);
+                        const Array4<const Real> phi_arr = phi_mf.array(mfi, comp);
+
+                        // the radii index each cell center maps into, see MakeRadialMap
+                        const Array4<const int> irreg_r_arr = cell_irreg_r[lev].array(mfi);
+
+                        // the range of radii this tile maps into
+                        int r_lo = nr_irreg;
+                        int r_hi = 0;
+                        for (int k = lo.z; k <= hi.z; ++k) {
+                            for (int j = lo.y; j <= hi.y; ++j) {
+                                for (int i = lo.x; i <= hi.x; ++i) {
+                                    r_lo = amrex::min(r_lo, irreg_r_arr(i,j,k));
+                                    r_hi = amrex::max(r_hi, irreg_r_arr(i,j,k));
+                                }
                             }
                         }
 
-                        amrex::HostDevice::Atomic::Add(&(phisum_p[lev+fine_lev*(index+1)]), phi_arr(i,j,k));
-                        amrex::HostDevice::Atomic::Add(&(ncell_p[lev+fine_lev*(index+1)]), 1);
+                        Real* bin = tile_sum.Tile(mfi.LocalTileIndex(), r_lo, r_hi);
+                        int* count = tile_count.Tile(mfi.LocalTileIndex(), r_lo, r_hi);
+
+                        for (int k = lo.z; k <= hi.z; ++k) {
+                            for (int j = lo.y; j <= hi.y; ++j) {
+                                for (int i = lo.x; i <= hi.x; ++i) {
+                                    // make sure the cell isn't covered by finer cells
+                                    if (!use_mask || mask_arr(i,j,k) != 1) {
+                                        const int index = irreg_r_arr(i,j,k);
+                                        bin[index-r_lo] += phi_arr(i,j,k);
+                                        count[index-r_lo] += 1;
+                                    }
+                                }
+                            }
+                        }
                     }
-                });
-            }
-        }
 
-        // reduction over boxes to get sum
-        ParallelDescriptor::ReduceRealSum(phisum.dataPtr(),(finest_level+1)*(nr_irreg+2));
-        ParallelDescriptor::ReduceIntSum(ncell.dataPtr(),(finest_level+1)*(nr_irreg+2));
-
-        // normalize phisum so it actually stores the average at a radius
-        for (auto n = 0; n <= finest_level; ++n) {
-            for (auto r = 0; r <= nr_irreg; ++r) {
-                if (ncell[n+fine_lev*(r+1)] != 0) {
-                    phisum[n+fine_lev*(r+1)] /= Real(ncell[n+fine_lev*(r+1)]);
+                    tile_sum.Merge(phisum_p, lev+fine_lev, fine_lev);
+                    if (count_cells) tile_count.Merge(ncell_all_p, lev+fine_lev, fine_lev);
                 }
             }
         }
 
-        IntVector which_lev(base_geom.nr_fine);
-        IntVector max_rcoord(fine_lev);
+        // reduction over boxes to get sum
+        for (int i = 0; i < nsum; ++i) {
+            phisum_batch[nbatch*nsum+i] = ncell_all[i];
+        }
+        ParallelReduceSum(phisum_batch.dataPtr(), (nbatch+1)*nsum);
+        for (int i = 0; i < nsum; ++i) {
+            ncell_all[i] = static_cast<int>(phisum_batch[nbatch*nsum+i]);
+        }
 
-        // compute center point for the finest level
-        phisum[finest_level] = (11.0/8.0) * phisum[finest_level+fine_lev]
-            - (3.0/8.0) * phisum[finest_level+fine_lev*2];
-        ncell[finest_level] = 1;
+        for (int ib = 0; ib < nbatch; ++ib) {
 
-        // choose which level to interpolate from
-        int * AMREX_RESTRICT which_lev_p = which_lev.dataPtr();
-        const Real dr0 = base_geom.dr(0);
-        const int nrf = base_geom.nr_fine;
+            // the lists below are squished in place, so every quantity
+            // works on its own copy
+            RealVector phisum(phisum_batch.begin() + ib*nsum,
+                              phisum_batch.begin() + (ib+1)*nsum);
+            RealVector radii(radii_all);
+            IntVector ncell(ncell_all);
 
-        AMREX_PARALLEL_FOR_1D(nrf, r, {
+            Real * AMREX_RESTRICT radii_p = radii.dataPtr();
+            Real * AMREX_RESTRICT phisum_p = phisum.dataPtr();
+            int * AMREX_RESTRICT ncell_p = ncell.dataPtr();
 
-            Real radius = (Real(r) + 0.5) * dr0;
-            // Vector<int> rcoord_p(fine_lev, 0);
-            int rcoord_p[MAESTRO_MAX_LEVELS];
 
-            // initialize
-            for (auto i = 0; i < MAESTRO_MAX_LEVELS; ++i) {
-                rcoord_p[i] = 0.0;
-            }
-
-            // for each level, find the closest coordinate
-            for (auto n = 0; n < fine_lev; ++n) {
-                for (auto j = rcoord_p[n]; j <= nr_irreg; ++j) {
-                    if (fabs(radius-radii_p[n+fine_lev*(j+1)]) < fabs(radius-radii_p[n+fine_lev*(j+2)])) {
-                        rcoord_p[n] = j;
-                        break;
+            // normalize phisum so it actually stores the average at a radius
+            for (auto n = 0; n <= finest_level; ++n) {
+                for (auto r = 0; r <= nr_irreg; ++r) {
+                    if (ncell[n+fine_lev*(r+1)] != 0) {
+                        phisum[n+fine_lev*(r+1)] /= Real(ncell[n+fine_lev*(r+1)]);
                     }
                 }
             }
 
-            // make sure closest coordinate is in bounds
-            for (auto n = 0; n < fine_lev-1; ++n) {
-                rcoord_p[n] = max(rcoord_p[n],1);
-            }
-            for (auto n = 0; n < fine_lev; ++n) {
-                rcoord_p[n] = min(rcoord_p[n],nr_irreg-1);
-            }
+            IntVector which_lev(base_geom.nr_fine);
+            IntVector max_rcoord(fine_lev);
+
+            // compute center point for the finest level
+            phisum[finest_level] = (11.0/8.0) * phisum[finest_level+fine_lev]
+                - (3.0/8.0) * phisum[finest_level+fine_lev*2];
+            ncell[finest_level] = 1;
 
-            // choose the level with the largest min over the ncell interpolation points
-            which_lev_p[r] = 0;
+            // choose which level to interpolate from
+            int * AMREX_RESTRICT which_lev_p = which_lev.dataPtr();
+            const Real dr0 = base_geom.dr(0);
+            const int nrf = base_geom.nr_fine;
 
-            int min_all = min(ncell_p[fine_lev*(rcoord_p[0])], 
-                ncell_p[fine_lev*(rcoord_p[0]+1)], 
-                ncell_p[fine_lev*(rcoord_p[0]+2)]);
+            AMREX_PARALLEL_FOR_1D(nrf, r, {
 
-            for (auto n = 1; n < fine_lev; ++n) {
-                int min_lev = min(ncell_p[n+fine_lev*(rcoord_p[n])], 
-                    ncell_p[n+fine_lev*(rcoord_p[n]+1)], 
-                    ncell_p[n+fine_lev*(rcoord_p[n]+2)]);
+                Real radius = (Real(r) + 0.5) * dr0;
+                // Vector<int> rcoord_p(fine_lev, 0);
+                int rcoord_p[MAESTRO_MAX_LEVELS];
 
-                if (min_lev > min_all) {
-                    min_all = min_lev;
-                    which_lev_p[r] = n;
+                // initialize
+                for (auto i = 0; i < MAESTRO_MAX_LEVELS; ++i) {
+                    rcoord_p[i] = 0.0;
                 }
-            }
 
-            // if the min hit count at all levels is zero, we expand the search
-            // to find the closest instance of where the hitcount becomes nonzero
-            int j = 1;
-            while (min_all == 0) {
-                j++;
+                // for each level, find the closest coordinate
                 for (auto n = 0; n < fine_lev; ++n) {
-                    int min_lev = max(ncell_p[n+fine_lev*(max(1,rcoord_p[n]-j)+1)], 
-                        ncell_p[n+fine_lev*(min(rcoord_p[n]+j,nr_irreg-1)+1)]);
-                    if (min_lev != 0) {
-                        which_lev_p[r] = n;
+                    for (auto j = rcoord_p[n]; j <= nr_irreg; ++j) {
+                        if (fabs(radius-radii_p[n+fine_lev*(j+1)]) < fabs(radius-radii_p[n+fine_lev*(j+2)])) {
+                            rcoord_p[n] = j;
+                            break;
+                        }
+                    }
+                }
+
+                // make sure closest coordinate is in bounds
+                for (auto n = 0; n < fine_lev-1; ++n) {
+                    rcoord_p[n] = max(rcoord_p[n],1);
+                }
+                for (auto n = 0; n < fine_lev; ++n) {
+                    rcoord_p[n] = min(rcoord_p[n],nr_irreg-1);
+                }
+
+                // choose the level with the largest min over the ncell interpolation points
+                which_lev_p[r] = 0;
+
+                int min_all = min(ncell_p[fine_lev*(rcoord_p[0])], 
+                    ncell_p[fine_lev*(rcoord_p[0]+1)], 
+                    ncell_p[fine_lev*(rcoord_p[0]+2)]);
+
+                for (auto n = 1; n < fine_lev; ++n) {
+                    int min_lev = min(ncell_p[n+fine_lev*(rcoord_p[n])], 
+                        ncell_p[n+fine_lev*(rcoord_p[n]+1)], 
+                        ncell_p[n+fine_lev*(rcoord_p[n]+2)]);
+
+                    if (min_lev > min_all) {
                         min_all = min_lev;
-                        break;
+                        which_lev_p[r] = n;
                     }
                 }
-            }
-        });
 
-        // squish the list at each level down to exclude points with no contribution
-        for (auto n = 0; n <= finest_level; ++n) {
-            int j = 0;
-            for (auto r = 0; r <= nr_irreg; ++r) {
-                while (ncell[n+fine_lev*(j+1)] == 0) {
+                // if the min hit count at all levels is zero, we expand the search
+                // to find the closest instance of where the hitcount becomes nonzero
+                int j = 1;
+                while (min_all == 0) {
                     j++;
-                    if (j > nr_irreg) {
-                        break;
+                    for (auto n = 0; n < fine_lev; ++n) {
+                        int min_lev = max(ncell_p[n+fine_lev*(max(1,rcoord_p[n]-j)+1)], 
+                            ncell_p[n+fine_lev*(min(rcoord_p[n]+j,nr_irreg-1)+1)]);
+                        if (min_lev != 0) {
+                            which_lev_p[r] = n;
+                            min_all = min_lev;
+                            break;
+                        }
                     }
                 }
-                if (j > nr_irreg) {
-                    for (auto i = r; i <= nr_irreg; ++i) {
-                        phisum[n+fine_lev*(i+1)] = 1.e99;
+            });
+
+            // squish the list at each level down to exclude points with no contribution
+            for (auto n = 0; n <= finest_level; ++n) {
+                int j = 0;
+                for (auto r = 0; r <= nr_irreg; ++r) {
+                    while (ncell[n+fine_lev*(j+1)] == 0) {
+                        j++;
+                        if (j > nr_irreg) {
+                            break;
+                        }
                     }
-                    for (auto i = r; i <= nr_irreg+1; ++i) {
-                        radii[n+fine_lev*(i+1)] = 1.e99;
+                    if (j > nr_irreg) {
+                        for (auto i = r; i <= nr_irreg; ++i) {
+                            phisum[n+fine_lev*(i+1)] = 1.e99;
+                        }
+                        for (auto i = r; i <= nr_irreg+1; ++i) {
+                            radii[n+fine_lev*(i+1)] = 1.e99;
+                        }
+                        max_rcoord[n] = r - 1;
+                        break;
+                    }
+                    phisum[n+fine_lev*(r+1)] = phisum[n+fine_lev*(j+1)];
+                    radii [n+fine_lev*(r+1)] = radii [n+fine_lev*(j+1)];
+                    ncell [n+fine_lev*(r+1)] = ncell [n+fine_lev*(j+1)];
+                    j++;
+                    if (j > nr_irreg) {
+                        max_rcoord[n] = r;
+                        break;
                     }
-                    max_rcoord[n] = r - 1;
-                    break;
-                }
-                phisum[n+fine_lev*(r+1)] = phisum[n+fine_lev*(j+1)];
-                radii [n+fine_lev*(r+1)] = radii [n+fine_lev*(j+1)];
-                ncell [n+fine_lev*(r+1)] = ncell [n+fine_lev*(j+1)];
-                j++;
-                if (j > nr_irreg) {
-                    max_rcoord[n] = r;
-                    break;
                 }
             }
-        }
 
-        // compute phibar
-        int * AMREX_RESTRICT max_rcoord_p = max_rcoord.dataPtr();
-        Real * AMREX_RESTRICT phibar_p = phibar.dataPtr();
+            // compute phibar
+            int * AMREX_RESTRICT max_rcoord_p = max_rcoord.dataPtr();
+            Real * AMREX_RESTRICT phibar_p = phibar_batch[ib]->dataPtr();
 
-        const Real drdxfac_loc = drdxfac;
+            const Real drdxfac_loc = drdxfac;
 
-        AMREX_PARALLEL_FOR_1D(nrf, r, {
+            AMREX_PARALLEL_FOR_1D(nrf, r, {
 
-            Real radius = (Real(r) + 0.5) * dr0;
-            int stencil_coord = 0;
+                Real radius = (Real(r) + 0.5) * dr0;
+                int stencil_coord = 0;
 
-            // find the closest coordinate
-            for (auto j = stencil_coord; j <= max_rcoord_p[which_lev_p[r]]; ++j) {
-                if (fabs(radius-radii_p[which_lev_p[r]+fine_lev*(j+1)]) < 
-                    fabs(radius-radii_p[which_lev_p[r]+fine_lev*(j+2)])) {
-                    stencil_coord = j;
-                    break;
+                // find the closest coordinate
+                for (auto j = stencil_coord; j <= max_rcoord_p[which_lev_p[r]]; ++j) {
+                    if (fabs(radius-radii_p[which_lev_p[r]+fine_lev*(j+1)]) < 
+                        fabs(radius-radii_p[which_lev_p[r]+fine_lev*(j+2)])) {
+                        stencil_coord = j;
+                        break;
+                    }
                 }
-            }
 
-            // make sure the interpolation points will be in bounds
-            if (which_lev_p[r] != fine_lev-1) {
-                stencil_coord = max(stencil_coord, 1);
-            }
-            stencil_coord = min(stencil_coord, 
-                    max_rcoord_p[which_lev_p[r]]-1);
-
-            bool limit = (r > nrf - 1 - drdxfac_loc*pow(2.0, (fine_lev-2))) ? false : true;
-
-            phibar_p[max_lev*r] = QuadInterp(radius, 
-                    radii_p[which_lev_p[r]+fine_lev*(stencil_coord)], 
-                    radii_p[which_lev_p[r]+fine_lev*(stencil_coord+1)], 
-                    radii_p[which_lev_p[r]+fine_lev*(stencil_coord+2)], 
-                    phisum_p[which_lev_p[r]+fine_lev*(stencil_coord)], 
-                    phisum_p[which_lev_p[r]+fine_lev*(stencil_coord+1)], 
-                    phisum_p[which_lev_p[r]+fine_lev*(stencil_coord+2)], limit);
-        });
+                // make sure the interpolation points will be in bounds
+                if (which_lev_p[r] != fine_lev-1) {
+                    stencil_coord = max(stencil_coord, 1);
+                }
+                stencil_coord = min(stencil_coord, 
+                        max_rcoord_p[which_lev_p[r]]-1);
+
+                bool limit = (r > nrf - 1 - drdxfac_loc*pow(2.0, (fine_lev-2))) ? false : true;
+
+                phibar_p[max_lev*r] = QuadInterp(radius, 
+                        radii_p[which_lev_p[r]+fine_lev*(stencil_coord)], 
+                        radii_p[which_lev_p[r]+fine_lev*(stencil_coord+1)], 
+                        radii_p[which_lev_p[r]+fine_lev*(stencil_coord+2)], 
+                        phisum_p[which_lev_p[r]+fine_lev*(stencil_coord)], 
+                        phisum_p[which_lev_p[r]+fine_lev*(stencil_coord+1)], 
+                        phisum_p[which_lev_p[r]+fine_lev*(stencil_coord+2)], limit);
+            });
+        }
     }
 }
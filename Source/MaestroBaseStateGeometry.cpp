@@ -135,187 +135,8 @@ Maestro::InitBaseStateMapSphr(const int lev, const MFIter& mfi,
 void 
 Maestro::ComputeCutoffCoords(const RealVector& rho0)
 {
-    // compute the coordinates of the anelastic cutoff
-    bool found = false;
-    const int max_lev = base_geom.max_radial_level + 1;
-    int which_lev = 0;
-
-    // find the finest level containing the anelastic cutoff density,
-    // and set the anelastic cutoff coord for this level
-    for (auto n = base_geom.finest_radial_level; n >= 0; --n) {
-        for (auto i = 1; i <= base_geom.numdisjointchunks(n); ++i) {
-            if (!found) {
-                int lo = base_geom.r_start_coord(n,i);
-                int hi = base_geom.r_end_coord(n,i);
-                for (auto r = lo; r <= hi; ++r) {
-                    if (rho0[n + max_lev*r] <= anelastic_cutoff_density) {
-                        base_geom.anelastic_cutoff_density_coord(n) = r;
-                        which_lev = n;
-                        found = true;
-                        break;
-                    }
-                }
-            }
-        }
-    }
-
-    // if the anelastic cutoff density was not found anywhere, { set
-    // it to above the top of the domain on the finest level
-    if (!found) {
-        which_lev = base_geom.finest_radial_level;
-        base_geom.anelastic_cutoff_density_coord(base_geom.finest_radial_level) = base_geom.nr(base_geom.finest_radial_level);
-    }
-
-    // set the anelastic cutoff coordinate on the finer levels
-    for (auto n = which_lev+1; n <= base_geom.finest_radial_level; ++n) {
-        base_geom.anelastic_cutoff_density_coord(n) = 2*base_geom.anelastic_cutoff_density_coord(n-1)+1;
-    }
-
-    // set the anelastic cutoff coordinate on the coarser levels
-    for (auto n = which_lev-1; n >= 0; --n) {
-        if (base_geom.anelastic_cutoff_density_coord(n+1) % 2 == 0) {
-            base_geom.anelastic_cutoff_density_coord(n) = base_geom.anelastic_cutoff_density_coord(n+1) / 2;
-        } else {
-            base_geom.anelastic_cutoff_density_coord(n) = base_geom.anelastic_cutoff_density_coord(n+1) / 2 + 1;
-        }
-    }
-    //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-
-    //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-    // compute the coordinates of the base cutoff density
-    found = false;
-
-    // find the finest level containing the base cutoff density,
-    // and set the base cutoff coord for this level
-    for (auto n = base_geom.finest_radial_level; n >= 0; --n) {
-        for (auto i = 1; i <= base_geom.numdisjointchunks(n); ++i) {
-            if (!found) {
-                int lo = base_geom.r_start_coord(n,i);
-                int hi = base_geom.r_end_coord(n,i);
-                for (auto r = lo; r <= hi; ++r) {
-                    if (rho0[n + max_lev*r] <= base_cutoff_density) {
-                        base_geom.base_cutoff_density_coord(n) = r;
-                        which_lev = n;
-                        found = true;
-                        break;
-                    }
-                }
-            }
-        }
-    }
-
-    // if the base cutoff density was not found anywhere, { set
-    // it to above the top of the domain on the finest level
-    if (!found) {
-        which_lev = base_geom.finest_radial_level;
-        base_geom.base_cutoff_density_coord(base_geom.finest_radial_level) = base_geom.nr(base_geom.finest_radial_level);
-    }
-
-    // set the base cutoff coordinate on the finer levels
-    // do n=which_lev+1,base_geom.finest_radial_level
-    for (auto n = which_lev+1; n <= base_geom.finest_radial_level; ++n) {
-        base_geom.base_cutoff_density_coord(n) = 2*base_geom.base_cutoff_density_coord(n-1)+1;
-    }
-
-    // set the base cutoff coordinate on the coarser levels
-    // do n=which_lev-1,0,-1
-    for (auto n = which_lev-1; n >= 0; --n) {
-        if (base_geom.base_cutoff_density_coord(n+1) % 2 == 0) {
-            base_geom.base_cutoff_density_coord(n) = base_geom.base_cutoff_density_coord(n+1) / 2;
-        } else {
-            base_geom.base_cutoff_density_coord(n) = base_geom.base_cutoff_density_coord(n+1) / 2 + 1;
-        }
-    }
-    //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-
-    //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-    // compute the coordinates of the burning cutoff density
-    found = false;
-
-    // find the finest level containing the burning cutoff density,
-    // and set the burning cutoff coord for this level
-    for (auto n = base_geom.finest_radial_level; n >= 0; --n) {
-        for (auto i = 1; i <= base_geom.numdisjointchunks(n); ++i) {
-            if (!found) {
-                int lo = base_geom.r_start_coord(n,i);
-                int hi = base_geom.r_end_coord(n,i);
-                for (auto r = lo; r <= hi; ++r) {
-                    if (rho0[n + max_lev*r] <= burning_cutoff_density_lo) {
-                        base_geom.burning_cutoff_density_lo_coord(n) = r;
-                        which_lev = n;
-                        found = true;
-                        break;
-                    }
-                }
-            }
-        }
-    }
-
-    // if the burning cutoff density was not found anywhere, { set
-    // it to above the top of the domain on the finest level
-    if (!found) {
-        which_lev = base_geom.finest_radial_level;
-        base_geom.burning_cutoff_density_lo_coord(base_geom.finest_radial_level) = base_geom.nr(base_geom.finest_radial_level);
-    }
-
-    // set the burning cutoff coordinate on the finer levels
-    // do n=which_lev+1,base_geom.finest_radial_level
-    for (auto n = which_lev+1; n <= base_geom.finest_radial_level; ++n) {
-        base_geom.burning_cutoff_density_lo_coord(n) = 2*base_geom.burning_cutoff_density_lo_coord(n-1)+1;
-    }
-
-    // set the burning cutoff coordinate on the coarser levels
-    // do n=which_lev-1,0,-1
-    for (auto n = which_lev-1; n >= 0; --n) {
-        if (base_geom.burning_cutoff_density_lo_coord(n+1)%2 == 0) {
-            base_geom.burning_cutoff_density_lo_coord(n) = base_geom.burning_cutoff_density_lo_coord(n+1) / 2;
-        } else {
-            base_geom.burning_cutoff_density_lo_coord(n) = base_geom.burning_cutoff_density_lo_coord(n+1) / 2 + 1;
-        }
-    }
-
-    // compute the coordinates of the burning cutoff density upper limit
-    found = false;
-
-    // find the finest level containing the burning cutoff density,
-    // and set the burning cutoff coord for this level
-    for (auto n=base_geom.finest_radial_level; n >= 0; --n) {
-        for (auto i = 1; i <= base_geom.numdisjointchunks(n); ++i) {
-            if (!found) {
-                int lo = base_geom.r_start_coord(n,i);
-                int hi = base_geom.r_end_coord(n,i);
-                for (auto r = lo; r <= hi; ++r) {
-                    if (rho0[n + max_lev*r] >= burning_cutoff_density_hi) {
-                        base_geom.burning_cutoff_density_hi_coord(n) = r;
-                        which_lev = n;
-                        found = true;
-                        break;
-                    }
-                }
-            }
-        }
-    }
-
-    // if the burning cutoff density was not found anywhere, { set
-    // it to above the bottom of the domain
-    if (!found) {
-        which_lev = base_geom.finest_radial_level;
-        base_geom.burning_cutoff_density_hi_coord(base_geom.finest_radial_level) = 0;
-    }
-
-    // set the burning cutoff coordinate on the finer levels
-    for (auto n = which_lev+1; n <= base_geom.finest_radial_level; ++n) {
-        base_geom.burning_cutoff_density_hi_coord(n) = 0;
-    }
-
-    // set the burning cutoff coordinate on the coarser levels
-    for (auto n = which_lev-1; n >= 0; --n) {
-        if (base_geom.burning_cutoff_density_hi_coord(n+1)%2 == 0) {
-            base_geom.burning_cutoff_density_hi_coord(n) = 0;
-        } else {
-            base_geom.burning_cutoff_density_hi_coord(n) = 0;
-        }
-    }
+    base_geom.ComputeCutoffCoords(
+        makeRadialBaseStateArray(rho0, base_geom.max_radial_level+1, base_geom.nr_fine));
 }
 
 // void 
@@ -404,26 +225,9 @@ Maestro::ComputeCutoffCoords(const RealVector& rho0)
 void 
 Maestro::RestrictBase(RealVector& s0, bool is_cell_centered)
 {
-    // timer for profiling
-    BL_PROFILE_VAR("Maestro::RestrictBase()", RestrictBase); 
-
     const int max_lev = base_geom.max_radial_level + 1;
-
-    for (int n = base_geom.finest_radial_level; n >= 1; --n) {        
-        for (int i = 1; i <= base_geom.numdisjointchunks(n); ++i) {
-            if (is_cell_centered) {
-                // for level n, make the coarser cells underneath simply the average of the fine
-                for (auto j = base_geom.r_start_coord(n,i); j < base_geom.r_end_coord(n,i); j+=2) {
-                    s0[n-1 + max_lev*j/2] = 0.5 * (s0[n + max_lev*j] + s0[n + max_lev*(j+1)]);
-                }
-            } else {
-                // for level n, make the coarse edge underneath equal to the fine edge value
-                for (auto j = base_geom.r_start_coord(n,i); j <= base_geom.r_end_coord(n,i)+1; j+=2) {
-                    s0[n-1 + max_lev*j/2] = s0[n + max_lev*j];
-                }
-            }
-        }
-    }
+    RestrictBase(makeRadialBaseStateArray(s0, max_lev, s0.size()/max_lev), 
+                 is_cell_centered);
 }
 
 void 
@@ -460,81 +264,9 @@ Maestro::RestrictBase(BaseStateArray<Real> s0, bool is_cell_centered)
 void 
 Maestro::FillGhostBase(RealVector& s0, bool is_cell_centered)
 {
-    // timer for profiling
-    BL_PROFILE_VAR("Maestro::FillGhostBase()", FillGhostBase); 
-
     const int max_lev = base_geom.max_radial_level + 1;
-
-    for (int n = base_geom.finest_radial_level; n >= 1; --n) {
-        for (int i = 1; i <= base_geom.numdisjointchunks(n); ++i) {
-
-            const int lo = base_geom.r_start_coord(n,i);
-            const int hi = base_geom.r_end_coord(n,i);
-
-            if (is_cell_centered) {
-
-                if (lo != 0) {
-                    int r_crse = lo/2-1;
-                    Real del = 0.5*(s0[n-1+max_lev*(r_crse+1)]-s0[n-1+max_lev*(r_crse-1)]);
-                    Real dpls = 2.0*(s0[n-1+max_lev*(r_crse+1)]-s0[n-1+max_lev*r_crse]);
-                    Real dmin = 2.0*(s0[n-1+max_lev*r_crse]-s0[n-1+max_lev*(r_crse-1)]);
-                    Real slim = min(fabs(dpls),fabs(dmin));
-                    slim = dpls*dmin > 0.0 ? slim : 0.0;
-                    Real slope = copysign(1.0,del)*min(slim,fabs(del));
-                    s0[n+max_lev*(lo-1)] = s0[n-1+max_lev*r_crse] + 0.25*slope;
-                    s0[n+max_lev*(lo-2)] = s0[n-1+max_lev*r_crse] - 0.25*slope;
-
-                    r_crse = lo/2-2;
-                    del = 0.5*(s0[n-1+max_lev*(r_crse+1)]-s0[n-1+max_lev*(r_crse-1)]);
-                    dpls = 2.0*(s0[n-1+max_lev*(r_crse+1)]-s0[n-1+max_lev*r_crse]);
-                    dmin = 2.0*(s0[n-1+max_lev*r_crse]-s0[n-1+max_lev*(r_crse-1)]);
-                    slim = min(fabs(dpls),fabs(dmin));
-                    slim = dpls*dmin > 0.0 ? slim : 0.0;
-                    slope = copysign(1.0,del)*min(slim,fabs(del));
-                    s0[n+max_lev*(lo-3)] = s0[n-1+max_lev*r_crse] + 0.25*slope;
-                    s0[n+max_lev*(lo-4)] = s0[n-1+max_lev*r_crse] - 0.25*slope;
-                }
-
-                if (hi != base_geom.nr(n)-1) {
-                    int r_crse = (hi+1)/2;
-                    Real del = 0.5*(s0[n-1+max_lev*(r_crse+1)]-s0[n-1+max_lev*(r_crse-1)]);
-                    Real dpls = 2.0*(s0[n-1+max_lev*(r_crse+1)]-s0[n-1+max_lev*r_crse]);
-                    Real dmin = 2.0*(s0[n-1+max_lev*r_crse]-s0[n-1+max_lev*(r_crse-1)]);
-                    Real slim = min(fabs(dpls),fabs(dmin));
-                    slim = dpls*dmin > 0.0 ? slim : 0.0;
-                    Real slope = copysign(1.0,del)*min(slim,fabs(del));
-                    s0[n+max_lev*(hi+1)] = s0[n-1+max_lev*r_crse] - 0.25*slope;
-                    s0[n+max_lev*(hi+2)] = s0[n-1+max_lev*r_crse] + 0.25*slope;
-
-                    r_crse = (hi+1)/2+1;
-                    del = 0.5*(s0[n-1+max_lev*(r_crse+1)]-s0[n-1+max_lev*(r_crse-1)]);
-                    dpls = 2.0*(s0[n-1+max_lev*(r_crse+1)]-s0[n-1+max_lev*r_crse]);
-                    dmin = 2.0*(s0[n-1+max_lev*r_crse]-s0[n-1+max_lev*(r_crse-1)]);
-                    slim = min(fabs(dpls),fabs(dmin));
-                    slim = dpls*dmin > 0.0 ? slim : 0.0;
-                    slope = copysign(1.0,del)*min(slim,fabs(del));
-                    s0[n+max_lev*(hi+3)] = s0[n-1+max_lev*r_crse] - 0.25*slope;
-                    s0[n+max_lev*(hi+4)] = s0[n-1+max_lev*r_crse] + 0.25*slope;
-                }
-            } else {
-                if (lo != 0) {
-                    // quadratic interpolation from the three closest points
-                    s0[n+max_lev*(lo-1)] = -s0[n+max_lev*(lo+1)]/3.0
-                        + s0[n+max_lev*lo] + s0[n-1+max_lev*(lo/2-1)]/3.0;
-                    // copy the next ghost cell value directly in from the coarser level
-                    s0[n+max_lev*(lo-2)] = s0[n-1+max_lev*((lo-2)/2)];
-                }
-
-                if (hi+1 != base_geom.nr(n)) {
-                    // quadratic interpolation from the three closest points
-                    s0[n+max_lev*(hi+2)] = -s0[n+max_lev*hi]/3.0
-                        + s0[n+max_lev*(hi+1)] + s0[n-1+max_lev*((hi+3)/2)]/3.0;
-                    // copy the next ghost cell value directly in from the coarser level
-                    s0[n+max_lev*(hi+3)] = s0[n-1+max_lev*((hi+3)/2)];
-                }
-            }
-        }
-    }
+    FillGhostBase(makeRadialBaseStateArray(s0, max_lev, s0.size()/max_lev), 
+                  is_cell_centered);
 }
 
 void 
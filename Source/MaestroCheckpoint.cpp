@@ -1,7 +1,12 @@
 
 #include <Maestro.H>
 #include <AMReX_VisMF.H>
+#include <AMReX_AsyncOut.H>
 #include <Maestro_F.H>
+#include <MaestroBaseStateIO.H>
+
+#include <cstdio>
+#include <sstream>
 
 using namespace amrex;
 
@@ -24,11 +29,25 @@ Maestro::WriteCheckPoint (int step) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::WriteCheckPoint()",WriteCheckPoint);
 
+    // only one checkpoint is written in the background at a time
+    FinishCheckPoint();
+
     // checkpoint file name, e.g., chk00010
     const std::string& checkpointname = amrex::Concatenate(check_base_name,step,7);
 
     amrex::Print() << "Writing checkpoint " << checkpointname << "\n";
 
+    // with chk_async, every file is staged in memory here and written by
+    // the AsyncOut thread while the time step loop continues.  The
+    // checkpoint goes to a temporary directory that FinishCheckPoint
+    // renames once every rank is done, so a run that dies while writing
+    // never leaves a partial checkpoint under the real name
+    const bool async = chk_async && AsyncOut::UseAsyncOut();
+    if (chk_async && !async) {
+        amrex::Print() << "chk_async requires amrex.async_out = 1, writing synchronously\n";
+    }
+    const std::string dirname = async ? checkpointname + ".temp" : checkpointname;
+
     const int nlevels = finest_level+1;
 
     // ---- prebuild a hierarchy of directories
@@ -37,23 +56,23 @@ Maestro::WriteCheckPoint (int step) {
     // ---- if callBarrier is true, call ParallelDescriptor::Barrier()
     // ---- after all directories are built
     // ---- ParallelDescriptor::IOProcessor() creates the directories
-    amrex::PreBuildDirectorHierarchy(checkpointname, "Level_", nlevels, true);
-
-    VisMF::IO_Buffer io_buffer(VisMF::IO_Buffer_Size);
+    amrex::PreBuildDirectorHierarchy(dirname, "Level_", nlevels, true);
+
+    // write a text file from the I/O processor
+    auto write_file = [async] (const std::string& name, std::string&& contents) {
+        if (async) {
+            AsyncOut::Submit([name, contents = std::move(contents)] () {
+                WriteFileContents(name, contents);
+            });
+        } else {
+            WriteFileContents(name, contents);
+        }
+    };
 
     // write Header file
     if (ParallelDescriptor::IOProcessor()) {
 
-        std::ofstream HeaderFile;
-        HeaderFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
-        std::string HeaderFileName(checkpointname + "/Header");
-        HeaderFile.open(HeaderFileName.c_str(), std::ofstream::out   |
-                        std::ofstream::trunc |
-                        std::ofstream::binary);
-
-        if( !HeaderFile.good()) {
-            amrex::FileOpenFailed(HeaderFileName);
-        }
+        std::ostringstream HeaderFile;
 
         HeaderFile.precision(17);
 
@@ -86,47 +105,56 @@ Maestro::WriteCheckPoint (int step) {
             HeaderFile << '\n';
         }
 
+        write_file(dirname + "/Header", HeaderFile.str());
+
         {
             // store elapsed CPU time
-            std::ofstream CPUFile;
-            std::string FullPathCPUFile(checkpointname + "/CPUtime");
-            CPUFile.open(FullPathCPUFile.c_str(), std::ios::out);
-
+            std::ostringstream CPUFile;
             CPUFile << std::setprecision(15) << getCPUTime();
-            CPUFile.close();
+            write_file(dirname + "/CPUtime", CPUFile.str());
         }
     }
 
-    // write the MultiFab data to, e.g., chk00010/Level_0/
+    // write the MultiFab data to, e.g., chk00010/Level_0/.  VisMF::AsyncWrite
+    // copies the data before returning, so the state may change afterwards
+    auto write_mf = [async, &dirname] (const MultiFab& mf, int lev, const std::string& name) {
+        const std::string prefix = amrex::MultiFabFileFullPrefix(lev, dirname, "Level_", name);
+        if (async) {
+            VisMF::AsyncWrite(mf, prefix);
+        } else {
+            VisMF::Write(mf, prefix);
+        }
+    };
+
     for (int lev = 0; lev <= finest_level; ++lev) {
-        VisMF::Write(snew[lev],
-                     amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "snew"));
-        VisMF::Write(unew[lev],
-                     amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "unew"));
-        VisMF::Write(gpi[lev],
-                     amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "gpi"));
-        VisMF::Write(dSdt[lev],
-                     amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "dSdt"));
-        VisMF::Write(S_cc_new[lev],
-                     amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "S_cc_new"));
+        write_mf(snew[lev], lev, "snew");
+        write_mf(unew[lev], lev, "unew");
+        write_mf(gpi[lev], lev, "gpi");
+        write_mf(dSdt[lev], lev, "dSdt");
+        write_mf(S_cc_new[lev], lev, "S_cc_new");
 #ifdef SDC
-        VisMF::Write(intra[lev],
-                     amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "intra"));
+        write_mf(intra[lev], lev, "intra");
 #endif
+        if (load_balance_type > 0) {
+            write_mf(burn_cost[lev], lev, "burn_cost");
+        }
     }
 
     // write out the cell-centered base state
-    if (ParallelDescriptor::IOProcessor()) {
+    if (ParallelDescriptor::IOProcessor() && chk_base_binary) {
 
-        std::ofstream BaseCCFile;
-        BaseCCFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
-        std::string BaseCCFileName(checkpointname + "/BaseCC");
-        BaseCCFile.open(BaseCCFileName.c_str(), std::ofstream::out   |
-                        std::ofstream::trunc |
-                        std::ofstream::binary);
-        if( !BaseCCFile.good()) {
-            amrex::FileOpenFailed(BaseCCFileName);
-        }
+        const Vector<const Real*> cols = {rho0_new.dataPtr(), p0_new.dataPtr(),
+                                          gamma1bar_new.dataPtr(), rhoh0_new.dataPtr(),
+                                          beta0_new.dataPtr(), psi.dataPtr(),
+                                          tempbar.dataPtr(), etarho_cc.dataPtr(),
+                                          tempbar_init.dataPtr(), p0_old.dataPtr(),
+                                          beta0_nm1.dataPtr()};
+
+        write_file(dirname + "/BaseCC", BaseStateBinary::Pack(cols, rho0_new.size()));
+
+    } else if (ParallelDescriptor::IOProcessor()) {
+
+        std::ostringstream BaseCCFile;
 
         BaseCCFile.precision(17);
 
@@ -143,20 +171,20 @@ Maestro::WriteCheckPoint (int step) {
                        << p0_old[i] << " "
                        << beta0_nm1.array(i) << "\n";
         }
+
+        write_file(dirname + "/BaseCC", BaseCCFile.str());
     }
 
     // write out the face-centered base state
-    if (ParallelDescriptor::IOProcessor()) {
+    if (ParallelDescriptor::IOProcessor() && chk_base_binary) {
 
-        std::ofstream BaseFCFile;
-        BaseFCFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
-        std::string BaseFCFileName(checkpointname + "/BaseFC");
-        BaseFCFile.open(BaseFCFileName.c_str(), std::ofstream::out   |
-                        std::ofstream::trunc |
-                        std::ofstream::binary);
-        if( !BaseFCFile.good()) {
-            amrex::FileOpenFailed(BaseFCFileName);
-        }
+        const Vector<const Real*> cols = {w0.dataPtr(), etarho_ec.dataPtr()};
+
+        write_file(dirname + "/BaseFC", BaseStateBinary::Pack(cols, w0.size()));
+
+    } else if (ParallelDescriptor::IOProcessor()) {
+
+        std::ostringstream BaseFCFile;
 
         BaseFCFile.precision(17);
 
@@ -164,9 +192,74 @@ Maestro::WriteCheckPoint (int step) {
             BaseFCFile << w0[i] << " "
                        << etarho_ec.array(i) << "\n";
         }
+
+        write_file(dirname + "/BaseFC", BaseFCFile.str());
+    }
+
+    WriteJobInfo(dirname);
+
+    if (async) {
+        chk_pending = checkpointname;
+    }
+}
+
+void
+Maestro::FinishCheckPoint ()
+{
+    if (chk_pending.empty()) {
+        return;
+    }
+
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::FinishCheckPoint()",FinishCheckPoint);
+
+    FinishAsyncDirectory(chk_pending);
+
+    amrex::Print() << "Finished checkpoint " << chk_pending << "\n";
+
+    chk_pending.clear();
+}
+
+// write `contents` to the file `name`; the checkpoint and plotfile
+// writers hand this to AsyncOut to write their files in the background
+void
+Maestro::WriteFileContents (const std::string& name, const std::string& contents)
+{
+    VisMF::IO_Buffer io_buffer(VisMF::IO_Buffer_Size);
+
+    std::ofstream File;
+    File.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
+    File.open(name.c_str(), std::ofstream::out   |
+              std::ofstream::trunc |
+              std::ofstream::binary);
+    if( !File.good()) {
+        amrex::FileOpenFailed(name);
     }
 
-    WriteJobInfo(checkpointname);
+    File.write(contents.data(), contents.size());
+}
+
+// wait for the background writes of every rank, then move the output
+// directory name.temp that they were written to onto name
+void
+Maestro::FinishAsyncDirectory (const std::string& name)
+{
+    // wait for the writes of this rank, then for every other rank
+    AsyncOut::Finish();
+    ParallelDescriptor::Barrier();
+
+    if (ParallelDescriptor::IOProcessor()) {
+        // as in PreBuildDirectorHierarchy, keep an existing directory
+        // with the same name
+        if (amrex::FileExists(name)) {
+            amrex::UtilRenameDirectoryToOld(name, false);
+        }
+        const std::string tempname = name + ".temp";
+        if (std::rename(tempname.c_str(), name.c_str()) != 0) {
+            amrex::Abort("FinishAsyncDirectory: could not rename " + tempname);
+        }
+    }
+    ParallelDescriptor::Barrier();
 }
 
 int
@@ -230,6 +323,16 @@ Maestro::ReadCheckPoint ()
             // create a distribution mapping
             DistributionMapping dm { ba, ParallelDescriptor::NProcs() };
 
+            // if the checkpoint has the burner cost, use it to weight
+            // the distribution mapping
+            const std::string cost_file =
+                amrex::MultiFabFileFullPrefix(lev, restart_file, "Level_", "burn_cost");
+            if (load_balance_type > 0 && amrex::FileExists(cost_file + "_H")) {
+                MultiFab cost(ba, dm, 1, 0);
+                VisMF::Read(cost, cost_file);
+                dm = MakeWeightedDistributionMap(ba, cost);
+            }
+
             // set BoxArray grids and DistributionMapping dmap in AMReX_AmrMesh.H class
             SetBoxArray(lev, ba);
             SetDistributionMap(lev, dm);
@@ -240,6 +343,8 @@ Maestro::ReadCheckPoint ()
             S_cc_old          [lev].define(ba, dm,              1,    0);
             gpi               [lev].define(ba, dm, AMREX_SPACEDIM,    0);
             dSdt              [lev].define(ba, dm,              1,    0);
+            burn_cost         [lev].define(ba, dm,              1,    0);
+            burn_cost         [lev].setVal(0.);
 
             // build FluxRegister data
             if (lev > 0 && reflux_type == 2) {
@@ -285,40 +390,52 @@ Maestro::ReadCheckPoint ()
     }
 
 
-    // BaseCC
+    // BaseCC, binary or ASCII
     {
         std::string File(restart_file + "/BaseCC");
         Vector<char> fileCharPtr;
         ParallelDescriptor::ReadAndBcastFile(File, fileCharPtr);
-        std::string fileCharPtrString(fileCharPtr.dataPtr());
-        std::istringstream is(fileCharPtrString, std::istringstream::in);
 
-        // read in cell-centered base state
-        for (int i=0; i<(base_geom.max_radial_level+1)*base_geom.nr_fine; ++i) {
-            std::getline(is, line);
-            std::istringstream lis(line);
-            lis >> word;
-            rho0_old[i] = std::stod(word);
-            lis >> word;
-            p0_old[i] = std::stod(word);
-            lis >> word;
-            gamma1bar_old[i] = std::stod(word);
-            lis >> word;
-            rhoh0_old[i] = std::stod(word);
-            lis >> word;
-            beta0_old.array()(i) = std::stod(word);
-            lis >> word;
-            psi.array()(i) = std::stod(word);
-            lis >> word;
-            tempbar[i] = std::stod(word);
-            lis >> word;
-            etarho_cc.array()(i) = std::stod(word);
-            lis >> word;
-            tempbar_init[i] = std::stod(word);
-            lis >> word;
-            p0_nm1[i] = std::stod(word);
-            lis >> word;
-            beta0_nm1.array()(i) = std::stod(word);
+        if (BaseStateBinary::IsBinary(fileCharPtr.dataPtr(), fileCharPtr.size())) {
+            const Vector<Real*> cols = {rho0_old.dataPtr(), p0_old.dataPtr(),
+                                        gamma1bar_old.dataPtr(), rhoh0_old.dataPtr(),
+                                        beta0_old.dataPtr(), psi.dataPtr(),
+                                        tempbar.dataPtr(), etarho_cc.dataPtr(),
+                                        tempbar_init.dataPtr(), p0_nm1.dataPtr(),
+                                        beta0_nm1.dataPtr()};
+            BaseStateBinary::Unpack(fileCharPtr.dataPtr(), fileCharPtr.size(),
+                                    cols, rho0_old.size(), File);
+        } else {
+            std::string fileCharPtrString(fileCharPtr.dataPtr());
+            std::istringstream is(fileCharPtrString, std::istringstream::in);
+
+            // read in cell-centered base state
+            for (int i=0; i<(base_geom.max_radial_level+1)*base_geom.nr_fine; ++i) {
+                std::getline(is, line);
+                std::istringstream lis(line);
+                lis >> word;
+                rho0_old[i] = std::stod(word);
+                lis >> word;
+                p0_old[i] = std::stod(word);
+                lis >> word;
+                gamma1bar_old[i] = std::stod(word);
+                lis >> word;
+                rhoh0_old[i] = std::stod(word);
+                lis >> word;
+                beta0_old.array()(i) = std::stod(word);
+                lis >> word;
+                psi.array()(i) = std::stod(word);
+                lis >> word;
+                tempbar[i] = std::stod(word);
+                lis >> word;
+                etarho_cc.array()(i) = std::stod(word);
+                lis >> word;
+                tempbar_init[i] = std::stod(word);
+                lis >> word;
+                p0_nm1[i] = std::stod(word);
+                lis >> word;
+                beta0_nm1.array()(i) = std::stod(word);
+            }
         }
     }
 
@@ -329,23 +446,30 @@ Maestro::ReadCheckPoint ()
         std::fill(rho0_old.begin(),  rho0_old.end(),  0.);
     }
 
-    // BaseFC
+    // BaseFC, binary or ASCII
     {
         std::string File(restart_file + "/BaseFC");
         Vector<char> fileCharPtr;
         ParallelDescriptor::ReadAndBcastFile(File, fileCharPtr);
-        std::string fileCharPtrString(fileCharPtr.dataPtr());
-        std::istringstream is(fileCharPtrString, std::istringstream::in);
 
-
-        // read in face-centered base state
-        for (int i=0; i<(base_geom.max_radial_level+1)*base_geom.nr_fine+1; ++i) {
-            std::getline(is, line);
-            std::istringstream lis(line);
-            lis >> word;
-            w0[i] = std::stod(word);
-            lis >> word;
-            etarho_ec.array()(i) = std::stod(word);
+        if (BaseStateBinary::IsBinary(fileCharPtr.dataPtr(), fileCharPtr.size())) {
+            const Vector<Real*> cols = {w0.dataPtr(), etarho_ec.dataPtr()};
+            BaseStateBinary::Unpack(fileCharPtr.dataPtr(), fileCharPtr.size(),
+                                    cols, w0.size(), File);
+        } else {
+            std::string fileCharPtrString(fileCharPtr.dataPtr());
+            std::istringstream is(fileCharPtrString, std::istringstream::in);
+
+
+            // read in face-centered base state
+            for (int i=0; i<(base_geom.max_radial_level+1)*base_geom.nr_fine+1; ++i) {
+                std::getline(is, line);
+                std::istringstream lis(line);
+                lis >> word;
+                w0[i] = std::stod(word);
+                lis >> word;
+                etarho_ec.array()(i) = std::stod(word);
+            }
         }
     }
 
@@ -26,6 +26,8 @@ Maestro::DiagFile (const int step,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::DiagFile()",DiagFile);
 
+    ThermoCacheDefine();
+
     const int max_lev = base_geom.max_radial_level + 1;
 
     // -- w0mac will contain an edge-centered w0 on a Cartesian grid,
@@ -65,18 +67,36 @@ Maestro::DiagFile (const int step,
         Put1dArrayOnCart(w0, w0r_cart, 1, 0, bcs_u, 0, 1);
     } 
 
-    // compute rho_Hext and rho_Hnuc
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        stemp             [lev].define(grids[lev], dmap[lev],   Nscal, 0);
-        rho_Hext          [lev].define(grids[lev], dmap[lev],       1, 0);
-        rho_omegadot      [lev].define(grids[lev], dmap[lev], NumSpec, 0);
-        rho_Hnuc          [lev].define(grids[lev], dmap[lev],       1, 0);
+    // reuse the reaction terms from the last advance if we have them
+    // on the current grids
+    bool have_react_terms = diag_react_source == 1 &&
+        diag_rho_Hnuc.size() == finest_level+1;
+    for (int lev = 0; lev <= finest_level && have_react_terms; ++lev) {
+        have_react_terms = diag_rho_Hnuc[lev].ok() &&
+            diag_rho_Hnuc[lev].boxArray() == grids[lev] &&
+            diag_rho_Hnuc[lev].DistributionMap() == dmap[lev];
     }
 
-    if (dt < small_dt) {
-        React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, small_dt, t_in);
+    if (have_react_terms) {
+        // the saved terms are only good for one set of diagnostics,
+        // so take them rather than copying them
+        std::swap(rho_Hext,     diag_rho_Hext);
+        std::swap(rho_omegadot, diag_rho_omegadot);
+        std::swap(rho_Hnuc,     diag_rho_Hnuc);
     } else {
-        React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, dt*0.5, t_in);
+        // compute rho_Hext and rho_Hnuc
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            stemp             [lev].define(grids[lev], dmap[lev],   Nscal, 0);
+            rho_Hext          [lev].define(grids[lev], dmap[lev],       1, 0);
+            rho_omegadot      [lev].define(grids[lev], dmap[lev], NumSpec, 0);
+            rho_Hnuc          [lev].define(grids[lev], dmap[lev],       1, 0);
+        }
+
+        if (dt < small_dt) {
+            React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, small_dt, t_in);
+        } else {
+            React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, dt*0.5, t_in);
+        }
     }
 
     // initialize diagnosis variables
@@ -104,7 +124,6 @@ Maestro::DiagFile (const int step,
         // diagnosis variables at each level
         // diag_temp.out
         Real T_max_local = 0.0;
-        Real T_center_level = 0.0;
         int ncenter_level = 0;
         Vector<Real> coord_Tmax_local(AMREX_SPACEDIM, 0.0);
         Vector<Real> vel_Tmax_local(AMREX_SPACEDIM, 0.0);
@@ -112,15 +131,11 @@ Maestro::DiagFile (const int step,
         // diag_vel.out
         Real U_max_level = 0.0;
         Real Mach_max_level = 0.0;
-        Real kin_ener_level = 0.0;
-        Real int_ener_level = 0.0;
-        Vector<Real> vel_center_level(AMREX_SPACEDIM, 0.0);
 
         // diag_enuc.out
         Real enuc_max_local = 0.0;
         Vector<Real> coord_enucmax_local(AMREX_SPACEDIM, 0.0);
         Vector<Real> vel_enucmax_local(AMREX_SPACEDIM, 0.0);
-        Real nuc_ener_level = 0.0;
 
         const auto dx = geom[lev].CellSizeArray();
 
@@ -134,14 +149,31 @@ Maestro::DiagFile (const int step,
         const BoxArray& fba = s_in[finelev].boxArray();
         const iMultiFab& mask = makeFineMask(s_in[lev], fba, IntVect(2));
 
+        // each tile accumulates its own sums and maxima, which are then
+        // merged in tile order, so the result does not depend on the
+        // number of threads.  The sums are, in order: the kinetic,
+        // internal and nuclear energies, T at the center and the velocity
+        // at the center
+        const int nsum = 4 + AMREX_SPACEDIM;
+        TileBinSum<Real> tile_sum(s_in[lev], TilingIfNotGPU());
+        TileBinSum<int> tile_ncenter(s_in[lev], TilingIfNotGPU());
+        // the maxima of T and enuc, with their location and velocity
+        TileArgMax tile_Tmax(s_in[lev], TilingIfNotGPU(), 2*AMREX_SPACEDIM);
+        TileArgMax tile_enucmax(s_in[lev], TilingIfNotGPU(), 2*AMREX_SPACEDIM);
+
         // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
-#pragma omp parallel reduction(+:kin_ener_level) reduction(+:int_ener_level) reduction(+:nuc_ener_level) reduction(max:U_max_level) reduction(max:Mach_max_level)
+#pragma omp parallel reduction(max:U_max_level) reduction(max:Mach_max_level)
 #endif
         for (MFIter mfi(s_in[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
 
             // Get the index space of the valid region
             const Box& tileBox = mfi.tilebox();
+            const int tile = mfi.LocalTileIndex();
+            Real* sum = tile_sum.Tile(tile, 0, nsum-1);
+            int* ncenter_tile = tile_ncenter.Tile(tile, 0, 0);
+            Real loc[2*AMREX_SPACEDIM];
+            const Array4<ThermoCacheEntry> thermo_cache_arr = ThermoCacheArray(lev, mfi);
 
             const auto lo = amrex::lbound(tileBox);
             const auto hi = amrex::ubound(tileBox);
@@ -197,13 +229,13 @@ Maestro::DiagFile (const int step,
                             fabs(y - center[1]) < dx[1] &&
                             fabs(z - center[2]) < dx[2]) {
                             
-                            ncenter_level++;
+                            ncenter_tile[0]++;
 
-                            T_center_level += scal(i,j,k,Temp);
+                            sum[3] += scal(i,j,k,Temp);
 
-                            vel_center_level[0] += u(i,j,k,0) + 0.5 * (w0macx(i,j,k) + w0macx(i+1,j,k));
-                            vel_center_level[1] += u(i,j,k,1) + 0.5 * (w0macy(i,j,k) + w0macy(i,j+1,k));
-                            vel_center_level[2] += u(i,j,k,2) + 0.5 * (w0macz(i,j,k) + w0macz(i,j,k+1));
+                            sum[4] += u(i,j,k,0) + 0.5 * (w0macx(i,j,k) + w0macx(i+1,j,k));
+                            sum[5] += u(i,j,k,1) + 0.5 * (w0macy(i,j,k) + w0macy(i,j+1,k));
+                            sum[6] += u(i,j,k,2) + 0.5 * (w0macz(i,j,k) + w0macz(i,j,k+1));
                         }
 
                         // velr is the projection of the velocity (including w0) onto
@@ -220,27 +252,17 @@ Maestro::DiagFile (const int step,
                             (u(i,j,k,2)+0.5*(w0macz(i,j,k)+w0macz(i,j,k+1))) * 
                             (u(i,j,k,2)+0.5*(w0macz(i,j,k)+w0macz(i,j,k+1))));
 
-                        // max T, location, and velocity at that location (including w0)
-                        if (scal(i,j,k,Temp) > T_max_local) {
-                            T_max_local  = scal(i,j,k,Temp);
-                            coord_Tmax_local[0] = x;
-                            coord_Tmax_local[1] = y;
-                            coord_Tmax_local[2] = z;
-                            vel_Tmax_local[0]   = u(i,j,k,0)+0.5*(w0macx(i,j,k)+w0macx(i+1,j,k));
-                            vel_Tmax_local[1]   = u(i,j,k,1)+0.5*(w0macy(i,j,k)+w0macy(i,j+1,k));
-                            vel_Tmax_local[2]   = u(i,j,k,2)+0.5*(w0macz(i,j,k)+w0macz(i,j,k+1));
-                        }
-                        
-                        // max enuc
-                        if (rho_Hnuc_arr(i,j,k)/scal(i,j,k,Rho) > enuc_max_local) {
-                            enuc_max_local = rho_Hnuc_arr(i,j,k)/scal(i,j,k,Rho);
-                            coord_enucmax_local[0] = x;
-                            coord_enucmax_local[1] = y;
-                            coord_enucmax_local[2] = z;
-                            vel_enucmax_local[0] = u(i,j,k,0)+0.5*(w0macx(i,j,k)+w0macx(i+1,j,k));
-                            vel_enucmax_local[1] = u(i,j,k,1)+0.5*(w0macy(i,j,k)+w0macy(i,j+1,k));
-                            vel_enucmax_local[2] = u(i,j,k,2)+0.5*(w0macz(i,j,k)+w0macz(i,j,k+1));
-                        }
+                        // location and velocity (including w0), for the
+                        // max T and max enuc
+                        loc[0] = x;
+                        loc[1] = y;
+                        loc[2] = z;
+                        loc[3] = u(i,j,k,0)+0.5*(w0macx(i,j,k)+w0macx(i+1,j,k));
+                        loc[4] = u(i,j,k,1)+0.5*(w0macy(i,j,k)+w0macy(i,j+1,k));
+                        loc[5] = u(i,j,k,2)+0.5*(w0macz(i,j,k)+w0macz(i,j,k+1));
+
+                        tile_Tmax.Update(tile, scal(i,j,k,Temp), loc);
+                        tile_enucmax.Update(tile, rho_Hnuc_arr(i,j,k)/scal(i,j,k,Rho), loc);
 #endif
                     } else {
                         // vel is the magnitude of the velocity, including w0
@@ -254,39 +276,22 @@ Maestro::DiagFile (const int step,
                                     u(i,j,k,1)*u(i,j,k,1) + vert_vel*vert_vel);
 #endif
 
-                        // max T, location, and velocity at that location (including w0)
-                        if (scal(i,j,k,Temp) > T_max_local) {
-                            T_max_local = scal(i,j,k,Temp);
-                            coord_Tmax_local[0] = x;
-                            coord_Tmax_local[1] = y;
-#if (AMREX_SPACEDIM == 3)
-                            coord_Tmax_local[2] = z;
-#endif                            
-                            vel_Tmax_local[0]   = u(i,j,k,0);
-                            vel_Tmax_local[1]   = u(i,j,k,1);
+                        // location and velocity (including w0), for the
+                        // max T and max enuc
+                        loc[0] = x;
+                        loc[1] = y;
 #if (AMREX_SPACEDIM == 2)
-                            vel_Tmax_local[1] += 0.5*(w0[lev+max_lev*j] + w0[lev+max_lev*(j+1)]);
+                        loc[2] = u(i,j,k,0);
+                        loc[3] = vert_vel;
 #else
-                            vel_Tmax_local[2] = u(i,j,k,2) + 0.5*(w0[lev+max_lev*k] + w0[lev+max_lev*(k+1)]);
+                        loc[2] = z;
+                        loc[3] = u(i,j,k,0);
+                        loc[4] = u(i,j,k,1);
+                        loc[5] = vert_vel;
 #endif
-                        }
 
-                        // max enuc
-                        if (rho_Hnuc_arr(i,j,k)/scal(i,j,k,Rho) > enuc_max_local) {
-                            enuc_max_local = rho_Hnuc_arr(i,j,k)/scal(i,j,k,Rho);
-                            coord_enucmax_local[0] = x;
-                            coord_enucmax_local[1] = y;
-#if (AMREX_SPACEDIM == 3)
-                            coord_enucmax_local[2] = z;
-#endif                            
-                            vel_enucmax_local[0]   = u(i,j,k,0);
-                            vel_enucmax_local[1]   = u(i,j,k,1);
-#if (AMREX_SPACEDIM == 2)
-                            vel_enucmax_local[1] += 0.5*(w0[lev+max_lev*j] + w0[lev+max_lev*(j+1)]);
-#else
-                            vel_enucmax_local[2] = u(i,j,k,2) + 0.5*(w0[lev+max_lev*k] + w0[lev+max_lev*(k+1)]);
-#endif
-                        }
+                        tile_Tmax.Update(tile, scal(i,j,k,Temp), loc);
+                        tile_enucmax.Update(tile, rho_Hnuc_arr(i,j,k)/scal(i,j,k,Rho), loc);
                     }
 
                     eos_t eos_state;
@@ -298,12 +303,12 @@ Maestro::DiagFile (const int step,
                         eos_state.xn[comp] = scal(i,j,k,FirstSpec+comp)/eos_state.rho;
                     }
                         
-                    eos(eos_input_rt, eos_state);
+                    eos_rt_cached(thermo_cache_arr, i, j, k, eos_state);
 
                     // kinetic, internal, and nuclear energies
-                    kin_ener_level += weight * scal(i,j,k,Rho) * vel*vel;
-                    int_ener_level += weight * scal(i,j,k,Rho) * eos_state.e;
-                    nuc_ener_level += weight * rho_Hnuc_arr(i,j,k);
+                    sum[0] += weight * scal(i,j,k,Rho) * vel*vel;
+                    sum[1] += weight * scal(i,j,k,Rho) * eos_state.e;
+                    sum[2] += weight * rho_Hnuc_arr(i,j,k);
                     
                     // max vel and Mach number
                     U_max_level = amrex::max(U_max_level, vel);
@@ -312,13 +317,38 @@ Maestro::DiagFile (const int step,
             }}}
         } // end MFIter
 
+        // merge the tiles
+        Real sum_level[nsum] = {0.0};
+        tile_sum.Merge(sum_level, 0, 1);
+        tile_ncenter.Merge(&ncenter_level, 0, 1);
+
+        Real Tmax_loc[2*AMREX_SPACEDIM];
+        Real enucmax_loc[2*AMREX_SPACEDIM];
+        for (int i = 0; i < 2*AMREX_SPACEDIM; ++i) {
+            Tmax_loc[i] = 0.0;
+            enucmax_loc[i] = 0.0;
+        }
+        tile_Tmax.Merge(T_max_local, Tmax_loc);
+        tile_enucmax.Merge(enuc_max_local, enucmax_loc);
+        for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+            coord_Tmax_local[i] = Tmax_loc[i];
+            vel_Tmax_local[i] = Tmax_loc[AMREX_SPACEDIM+i];
+            coord_enucmax_local[i] = enucmax_loc[i];
+            vel_enucmax_local[i] = enucmax_loc[AMREX_SPACEDIM+i];
+        }
+
         // sum quantities over all processors
-        ParallelDescriptor::ReduceRealSum(T_center_level);
-        ParallelDescriptor::ReduceRealSum(vel_center_level.dataPtr(),AMREX_SPACEDIM);
-        ParallelDescriptor::ReduceRealSum(kin_ener_level);
-        ParallelDescriptor::ReduceRealSum(int_ener_level);
-        ParallelDescriptor::ReduceRealSum(nuc_ener_level);
-        ParallelDescriptor::ReduceIntSum(ncenter_level);
+        ParallelReduceSum(sum_level, nsum);
+        ParallelReduceSum(&ncenter_level, 1);
+
+        const Real kin_ener_level = sum_level[0];
+        const Real int_ener_level = sum_level[1];
+        const Real nuc_ener_level = sum_level[2];
+        const Real T_center_level = sum_level[3];
+        Vector<Real> vel_center_level(AMREX_SPACEDIM);
+        for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+            vel_center_level[i] = sum_level[4+i];
+        }
 
         // find the largest U and Mach number over all processors
         ParallelDescriptor::ReduceRealMax(U_max_level);
@@ -781,6 +811,24 @@ Maestro::DiagFile (const int step,
     } // } IOProcessor
 }
 
+// hold on to the reaction terms from the last reaction step of the
+// advance, so that DiagFile does not have to react the state again.
+// The MultiFabs are swapped rather than copied; whatever was stored
+// before is handed back in the arguments
+void
+Maestro::SaveDiagReactTerms (Vector<MultiFab>& rho_Hext,
+                             Vector<MultiFab>& rho_omegadot,
+                             Vector<MultiFab>& rho_Hnuc)
+{
+    if (diag_react_source != 1) {
+        return;
+    }
+
+    std::swap(rho_Hext,     diag_rho_Hext);
+    std::swap(rho_omegadot, diag_rho_omegadot);
+    std::swap(rho_Hnuc,     diag_rho_Hnuc);
+}
+
 // put together a vector of multifabs for writing
 void
 Maestro::WriteDiagFile (int& index)
@@ -80,11 +80,6 @@ Maestro::EstDt ()
 
 #if (AMREX_SPACEDIM == 3)
     // build and initialize grad_p0 for spherical case
-    Vector<MultiFab> gp0_cart(finest_level+1);
-    for (int lev=0; lev<=finest_level; ++lev) {
-        gp0_cart[lev].define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        gp0_cart[lev].setVal(0.);
-    }
     RealVector gp0( (base_geom.max_radial_level+1)*(base_geom.nr_fine+1) );
     gp0.shrink_to_fit();
     std::fill(gp0.begin(),gp0.end(), 0.);
@@ -93,20 +88,8 @@ Maestro::EstDt ()
     if (spherical == 1) {
         EstDt_Divu(gp0, p0_old, gamma1bar_old);
     }
-      
-    Put1dArrayOnCart (gp0,gp0_cart,1,1,bcs_f,0);
 #endif
 
-    Vector<MultiFab> p0_cart(finest_level+1);
-    Vector<MultiFab> gamma1bar_cart(finest_level+1);
-    for (int lev=0; lev<=finest_level; ++lev) {
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 1);
-        gamma1bar_cart[lev].define(grids[lev], dmap[lev], 1, 1);
-    }
-
-    Put1dArrayOnCart(p0_old,p0_cart,0,0,bcs_f,0);
-    Put1dArrayOnCart(gamma1bar_old,gamma1bar_cart,0,0,bcs_f,0);
-
     Real umax = 0.;
 
     Real dt_lev = 1.e50;
@@ -139,8 +122,8 @@ Maestro::EstDt ()
                 const Array4<const Real> S_cc_arr = S_cc_old[lev].array(mfi);
                 const Array4<const Real> dSdt_arr = dSdt[lev].array(mfi);
                 const Array4<const Real> w0_arr = w0_cart[lev].array(mfi);
-                const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
-                const Array4<const Real> gamma1bar_arr = gamma1bar_cart[lev].array(mfi);
+                const auto p0_arr = MakeBaseStateCart(lev, mfi, p0_old, 0);
+                const auto gamma1bar_arr = MakeBaseStateCart(lev, mfi, gamma1bar_old, 0);
 
                 const Array4<Real> spd = tmp.array(mfi);
 
@@ -255,7 +238,7 @@ Maestro::EstDt ()
                     const Array4<const Real> w0macx = w0mac[lev][0].array(mfi);
                     const Array4<const Real> w0macy = w0mac[lev][1].array(mfi);
                     const Array4<const Real> w0macz = w0mac[lev][2].array(mfi);
-                    const Array4<const Real> gp0_arr = gp0_cart[lev].array(mfi);
+                    const auto gp0_arr = MakeBaseStateCart(lev, mfi, gp0, 1);
 
                     const Real rho_min = 1.e-20;
                     Real dt_temp = 1.e99;
@@ -399,6 +382,8 @@ Maestro::FirstDt ()
     // timer for profiling
     BL_PROFILE_VAR("Maestro::FirstDt()", FirstDt);
 
+    ThermoCacheDefine();
+
     dt = 1.e20;
 
     // allocate a dummy w0_force and set equal to zero
@@ -440,11 +425,6 @@ Maestro::FirstDt ()
 
 #if (AMREX_SPACEDIM == 3)
     // build and initialize grad_p0 for spherical case
-    Vector<MultiFab> gp0_cart(finest_level+1);
-    for (int lev=0; lev<=finest_level; ++lev) {
-        gp0_cart[lev].define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        gp0_cart[lev].setVal(0.);
-    }
     RealVector gp0( (base_geom.max_radial_level+1)*(base_geom.nr_fine+1) );
     gp0.shrink_to_fit();
     std::fill(gp0.begin(),gp0.end(), 0.);
@@ -453,20 +433,8 @@ Maestro::FirstDt ()
     if (use_divu_firstdt && spherical) {
         EstDt_Divu(gp0, p0_old, gamma1bar_old);
     }
-
-    Put1dArrayOnCart(gp0,gp0_cart,1,1,bcs_f,0);
 #endif
 
-    Vector<MultiFab> p0_cart(finest_level+1);
-    Vector<MultiFab> gamma1bar_cart(finest_level+1);
-    for (int lev=0; lev<=finest_level; ++lev) {
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 1);
-        gamma1bar_cart[lev].define(grids[lev], dmap[lev], 1, 1);
-    }
-
-    Put1dArrayOnCart(p0_old, p0_cart, 0, 0, bcs_f, 0);
-    Put1dArrayOnCart(gamma1bar_old, gamma1bar_cart, 0,0, bcs_f, 0);
-
     Real umax = 0.;
 
     for (int lev = 0; lev <= finest_level; ++lev) {
@@ -490,14 +458,15 @@ Maestro::FirstDt ()
 
                 // Get the index space of the valid region
                 const Box& tileBox = mfi.tilebox();
+                const Array4<ThermoCacheEntry> thermo_cache_arr = ThermoCacheArray(lev, mfi);
                 const auto dx = geom[lev].CellSizeArray();
 
                 const Array4<const Real> scal_arr = sold[lev].array(mfi);
                 const Array4<const Real> u = uold[lev].array(mfi);
                 const Array4<const Real> force = vel_force[lev].array(mfi);
                 const Array4<const Real> S_cc_arr = S_cc_old[lev].array(mfi);
-                const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
-                const Array4<const Real> gamma1bar_arr = gamma1bar_cart[lev].array(mfi);
+                const auto p0_arr = MakeBaseStateCart(lev, mfi, p0_old, 0);
+                const auto gamma1bar_arr = MakeBaseStateCart(lev, mfi, gamma1bar_old, 0);
 
                 const Real eps = 1.e-8;
                 const Real rho_min = 1.e-20;
@@ -520,7 +489,7 @@ Maestro::FirstDt ()
                     }
 
                     // dens, temp, and xmass are inputs
-                    eos(eos_input_rt, eos_state);
+                    eos_rt_cached(thermo_cache_arr, i, j, k, eos_state);
 
                     spd_arr(i,j,k) = eos_state.cs;
                 });
@@ -610,7 +579,7 @@ Maestro::FirstDt ()
                         dt_divu = tmp[mfi].min<RunOn::Device>(tileBox, 0);
                     } else {
 #if (AMREX_SPACEDIM == 3)
-                        const Array4<const Real> gp0_arr = gp0_cart[lev].array(mfi);
+                        const auto gp0_arr = MakeBaseStateCart(lev, mfi, gp0, 1);
 
                         AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
                             Real gp_dot_u = 0.0;
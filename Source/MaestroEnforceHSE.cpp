@@ -23,8 +23,7 @@ Maestro::EnforceHSE(const RealVector& rho0,
 
     Real offset = 0.0;
 
-    const BaseState<Real> rho0_b(rho0, base_geom.max_radial_level+1, base_geom.nr_fine);
-    MakeGravEdge(grav_edge_s, rho0_b);
+    MakeGravEdge(grav_edge, makeRadialBaseStateArray(rho0, max_lev, base_geom.nr_fine));
 
     // create a copy of the input pressure to help us with initial
     // conditions
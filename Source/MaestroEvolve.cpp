@@ -134,6 +134,24 @@ Maestro::Evolve ()
                                 gamma1bar_new,unew,snew,S_cc_new);
         }
 
+        if ( (profile_int > 0 && istep % profile_int == 0) ||
+             (profile_deltat > 0 && std::fmod(t_new, profile_deltat) < dt) ||
+             ((profile_int > 0 || profile_deltat > 0) && (istep == max_step  || t_old >= stop_time)) )
+        {
+            // append the radial profiles
+            WriteProfiles(istep,t_new,dt,rho0_new,rhoh0_new,p0_new,
+                          gamma1bar_new,unew,snew,S_cc_new);
+        }
+
+        if ( (slice_int > 0 && istep % slice_int == 0) ||
+             (slice_deltat > 0 && std::fmod(t_new, slice_deltat) < dt) ||
+             ((slice_int > 0 || slice_deltat > 0) && (istep == max_step  || t_old >= stop_time)) )
+        {
+            // write the slice plotfiles
+            WriteSlices(istep,t_new,dt,rho0_new,rhoh0_new,p0_new,
+                        gamma1bar_new,unew,snew,S_cc_new);
+        }
+
         if ( (chk_int > 0 && istep % chk_int == 0) ||
             (chk_deltat > 0 && std::fmod(t_new, chk_deltat) < dt) ||
             ((chk_int > 0 || chk_deltat > 0) && (istep == max_step ||
@@ -166,4 +184,9 @@ Maestro::Evolve ()
         std::swap(gamma1bar_old,gamma1bar_new);
         std::swap(grav_cell_old,grav_cell_new);
     }
+
+    // complete the last checkpoint and plotfile if they are still being
+    // written
+    FinishCheckPoint();
+    FinishPlotFile();
 }
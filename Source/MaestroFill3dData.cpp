@@ -94,326 +94,58 @@ Maestro::Put1dArrayOnCart (const int lev,
                            const Vector<BCRec>& bcs,
                            const int sbccomp)
 {
-    // timer for profiling
-    BL_PROFILE_VAR("Maestro::Put1dArrayOnCart_lev()", Put1dArrayOnCart);
-
-    const auto dx = geom[lev].CellSizeArray();
-    const auto prob_lo = geom[lev].ProbLoArray();
-    const auto center_p = center;
-
-    const auto& r_edge_loc = base_geom.r_edge_loc;
-    const auto& r_cc_loc = base_geom.r_cc_loc;
-    const Real * AMREX_RESTRICT s0_p = s0.dataPtr();
-
     const int max_lev = base_geom.max_radial_level+1;
-    const int nr_fine = base_geom.nr_fine;
-    const int w0_interp_type_loc = w0_interp_type;
-
-    // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
-#ifdef _OPENMP
-#pragma omp parallel
-#endif
-    for ( MFIter mfi(s0_cart, TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
-
-        // Get the index space of the valid region
-        const Box& tileBox = mfi.tilebox();
-
-        const Array4<Real> s0_cart_arr = s0_cart.array(mfi);
-
-        if (spherical == 0) {
-
-            const int outcomp = is_output_a_vector == 1 ? AMREX_SPACEDIM-1 : 0;
-
-            AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
-                const int r = AMREX_SPACEDIM == 2 ? j : k;
-
-                s0_cart_arr(i,j,k,outcomp) = is_input_edge_centered == 1 ? 
-                    0.5 * (s0_p[lev+r*max_lev] + s0_p[lev+(r+1)*max_lev]) : 
-                    s0_p[lev+r*max_lev];
-            });
-
-        } else {
-
-            const Array4<const Real> cc_to_r = cell_cc_to_r[lev].array(mfi);
-
-            if (use_exact_base_state) {
-                if (is_input_edge_centered) {
-                    // we implemented three different ideas for computing s0_cart,
-                    // where s0 is edge-centered.
-                    // 1.  Piecewise constant
-                    // 2.  Piecewise linear
-                    // 3.  Quadratic
-
-                    AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
-
-                        Real x = prob_lo[0] + (Real(i)+0.5) * dx[0] - center_p[0];
-                        Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
-                        Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x*x + y*y + z*z);
-                        int index = round(cc_to_r(i,j,k));
-
-                        Real rfac;
-                        if (index < nr_fine) {
-                            rfac = (radius - r_edge_loc(0,index+1)) 
-                            / (r_cc_loc(0,index+1) 
-                                - r_cc_loc(0,index));
-                        } else {
-                            rfac = (radius - r_edge_loc(0,index+1)) 
-                            / (r_cc_loc(0,index) 
-                                - r_cc_loc(0,index-1));
-                        }
-
-                        Real s0_cart_val = s0_p[index*max_lev];
-
-                        if (w0_interp_type_loc == 1) {
-
-                            s0_cart_val = rfac > 0.5 ? 
-                                s0_p[(index+1)*max_lev] : s0_p[index*max_lev];
-
-                        } else if (w0_interp_type_loc == 2) {
-                            
-                            if (index < nr_fine) {
-                                s0_cart_val = rfac * s0_p[(index+1)*max_lev] 
-                                    + (1.0-rfac) * s0_p[index*max_lev];
-                            } else {
-                                s0_cart_val = s0_p[nr_fine*max_lev];
-                            }
-
-                        } else if (w0_interp_type_loc == 3) {
-                            if (index <= 0) {
-                                index = 0;
-                            } else if (index >= nr_fine-1) {
-                                index = nr_fine - 2;
-                            } else if (radius-r_edge_loc(0,index) 
-                                    < r_edge_loc(0,index+1)) {
-                                index--;
-                            }
-
-                            s0_cart_val = QuadInterp(radius, 
-                                r_edge_loc(0,index),
-                                r_edge_loc(0,index+1), 
-                                r_edge_loc(0,index+2), 
-                                s0_p[index*max_lev],
-                                s0_p[(index+1)*max_lev],
-                                s0_p[(index+2)*max_lev]);
-                        }
-
-                        if (is_output_a_vector) {
-                            s0_cart_arr(i,j,k,0) = s0_cart_val * x / radius;
-                            s0_cart_arr(i,j,k,1) = s0_cart_val * y / radius;
-                            s0_cart_arr(i,j,k,2) = s0_cart_val * z / radius;
-                        } else {
-                            s0_cart_arr(i,j,k,0) = s0_cart_val;
-                        }
-                    });
-
-                } else { // is_input_edge_centered = 0
-                    // we directly inject the spherical values into each cell center
-                    // because s0 is also bin-centered.
-
-                    AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
-
-                        Real x = prob_lo[0] + (Real(i)+0.5) * dx[0] - center_p[0];
-                        Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
-                        Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x*x + y*y + z*z);
-                        int index = round(cc_to_r(i,j,k));
-
-                        Real s0_cart_val = s0_p[index*max_lev];
-                        
-                        if (is_output_a_vector) {
-                            s0_cart_arr(i,j,k,0) = s0_cart_val * x / radius;
-                            s0_cart_arr(i,j,k,1) = s0_cart_val * y / radius;
-                            s0_cart_arr(i,j,k,2) = s0_cart_val * z / radius;
-                        } else {
-                            s0_cart_arr(i,j,k,0) = s0_cart_val;
-                        }
-                    });
-                } // is_input_edge_centered
-
-            } else { // use_exact_base_state = 0
-
-                const Real drf = base_geom.dr_fine;
-
-                if (is_input_edge_centered) {
-                    // we implemented three different ideas for computing s0_cart,
-                    // where s0 is edge-centered.
-                    // 1.  Piecewise constant
-                    // 2.  Piecewise linear
-                    // 3.  Quadratic
-
-                    AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
-
-                        Real x = prob_lo[0] + (Real(i)+0.5) * dx[0] - center_p[0];
-                        Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
-                        Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x*x + y*y + z*z);
-
-                        int index = int(radius / drf);
-                        Real rfac = (radius - Real(index) * drf) / drf;
-                        Real s0_cart_val = 0.0;
-
-                        if (w0_interp_type_loc == 1) {
-
-                            s0_cart_val = rfac > 0.5 ? 
-                                s0_p[(index+1)*max_lev] : s0_p[index*max_lev];
-
-                        } else if (w0_interp_type_loc == 2) {
-                            
-                            if (index < nr_fine) {
-                                s0_cart_val = rfac * s0_p[(index+1)*max_lev] + (1.0-rfac) * s0_p[index*max_lev];
-                            } else {
-                                s0_cart_val = s0_p[nr_fine*max_lev];
-                            }
-
-                        } else if (w0_interp_type_loc == 3) {
-                            
-                            if (index <= 0) {
-                                index = 0;
-                            } else if (index >= nr_fine-1) {
-                                index = nr_fine - 2;
-                            } else if (radius-r_edge_loc(0,index) 
-                                    < r_edge_loc(0,index+1)) {
-                                index--;
-                            }
-
-                            s0_cart_val = QuadInterp(radius, 
-                                r_edge_loc(0,index),
-                                r_edge_loc(0,index+1), 
-                                r_edge_loc(0,index+2), 
-                                s0_p[index*max_lev],
-                                s0_p[(index+1)*max_lev],
-                                s0_p[(index+2)*max_lev]);
-                        }
-                        
-                        if (is_output_a_vector) {
-                            s0_cart_arr(i,j,k,0) = s0_cart_val * x / radius;
-                            s0_cart_arr(i,j,k,1) = s0_cart_val * y / radius;
-                            s0_cart_arr(i,j,k,2) = s0_cart_val * z / radius;
-                        } else {
-                            s0_cart_arr(i,j,k,0) = s0_cart_val;
-                        }
-                    });
-
-                } else { // is_input_edge_centered = 0
-
-                    const int s0_interp_type_loc = s0_interp_type;
-
-                    // we currently have three different ideas for computing s0_cart,
-                    // where s0 is bin-centered.
-                    // 1.  Piecewise constant
-                    // 2.  Piecewise linear
-                    // 3.  Quadratic
-                    // AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
-                    ParallelFor(tileBox, 
-                    [=] AMREX_GPU_DEVICE(int i, int j, int k)
-                    {
-                        Real x = prob_lo[0] + (Real(i)+0.5) * dx[0] - center_p[0];
-                        Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
-                        Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x*x + y*y + z*z);
-                        int index = int(radius / drf);
-
-                        Real s0_cart_val = 0.0;
-
-                        if (s0_interp_type_loc == 1) {
-
-                            s0_cart_val = s0_p[index*max_lev];
-
-                        } else if (s0_interp_type_loc == 2) {
-
-                            if (radius >= r_cc_loc(0,index)) {
-                                if (index >= nr_fine-1) {
-                                    s0_cart_val = s0_p[(nr_fine-1)*max_lev];
-                                } else {
-                                    s0_cart_val = s0_p[(index+1)*max_lev] 
-                                        * (radius-r_cc_loc(0,index))/drf 
-                                        + s0_p[index*max_lev] 
-                                        * (r_cc_loc(0,index+1)-radius)/drf;
-                                }
-                            } else {
-                                if (index == 0) {
-                                    s0_cart_val = s0_p[index*max_lev];
-                                } else if (index > nr_fine-1) {
-                                    s0_cart_val = s0_p[(nr_fine-1)*max_lev];
-                                } else {
-                                    s0_cart_val = s0_p[index*max_lev] 
-                                        * (radius-r_cc_loc(0,index-1))/drf 
-                                        + s0_p[(index-1)*max_lev] 
-                                        * (r_cc_loc(0,index)-radius)/drf;
-                                }
-                            }
-                        } else if (s0_interp_type_loc == 3) {
-                            if (index == 0) {
-                                index = 1;
-                            } else if (index >= nr_fine-1) {
-                                index = nr_fine-2;
-                            }
-
-                            s0_cart_val = QuadInterp(radius, 
-                                r_cc_loc(0,index-1),
-                                r_cc_loc(0,index),
-                                r_cc_loc(0,index+1), 
-                                s0_p[(index-1)*max_lev],
-                                s0_p[index*max_lev],
-                                s0_p[(index+1)*max_lev]);
-                        }
-                        
-                        if (is_output_a_vector) {
-                            s0_cart_arr(i,j,k,0) = s0_cart_val * x / radius;
-                            s0_cart_arr(i,j,k,1) = s0_cart_val * y / radius;
-                            s0_cart_arr(i,j,k,2) = s0_cart_val * z / radius;
-                        } else {
-                            s0_cart_arr(i,j,k,0) = s0_cart_val;
-                        }
-                    });
-                } // is_input_edge_centered
-            } // use_exact_base_state
-        }
-    }
+    Put1dArrayOnCart(lev, makeRadialBaseStateArray(s0, max_lev, s0.size()/max_lev), 
+                     s0_cart, is_input_edge_centered, is_output_a_vector, bcs, sbccomp);
 }
 
 void
 Maestro::Put1dArrayOnCart (int lev,
-                           const BaseState<Real>& s0_state,
+                           const BaseState<Real>& s0,
                            Vector<MultiFab>& s0_cart,
                            int is_input_edge_centered,
                            int is_output_a_vector,
                            const Vector<BCRec>& bcs,
                            int sbccomp)
+{
+    Put1dArrayOnCart(lev, s0.const_array(), s0_cart[lev], 
+                     is_input_edge_centered, is_output_a_vector, bcs, sbccomp);
+}
+
+void
+Maestro::Put1dArrayOnCart (const int lev,
+                           const BaseStateArray<const Real> s0,
+                           MultiFab& s0_cart,
+                           const int is_input_edge_centered,
+                           const int is_output_a_vector,
+                           const Vector<BCRec>& bcs,
+                           const int sbccomp)
 {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::Put1dArrayOnCart_lev()", Put1dArrayOnCart);
 
     const auto dx = geom[lev].CellSizeArray();
     const auto prob_lo = geom[lev].ProbLoArray();
-    const auto& center_p = center;
+    const auto center_p = center;
 
     const auto& r_edge_loc = base_geom.r_edge_loc;
     const auto& r_cc_loc = base_geom.r_cc_loc;
 
-    const int max_lev = base_geom.max_radial_level+1;
     const int nr_fine = base_geom.nr_fine;
     const int w0_interp_type_loc = w0_interp_type;
 
-    const auto s0 = s0_state.array();
-
     // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
-    for (MFIter mfi(s0_cart[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+    for ( MFIter mfi(s0_cart, TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
 
         // Get the index space of the valid region
         const Box& tileBox = mfi.tilebox();
 
-        const Array4<Real> s0_cart_arr = s0_cart[lev].array(mfi);
-        
-        if (!spherical) {
+        const Array4<Real> s0_cart_arr = s0_cart.array(mfi);
+
+        if (spherical == 0) {
 
             const int outcomp = is_output_a_vector == 1 ? AMREX_SPACEDIM-1 : 0;
 
@@ -428,6 +160,7 @@ Maestro::Put1dArrayOnCart (int lev,
         } else {
 
             const Array4<const Real> cc_to_r = cell_cc_to_r[lev].array(mfi);
+            const Array4<const Real> radius_arr = cell_radius[lev].array(mfi);
 
             if (use_exact_base_state) {
                 if (is_input_edge_centered) {
@@ -443,11 +176,11 @@ Maestro::Put1dArrayOnCart (int lev,
                         Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
-                        int index = cc_to_r(i,j,k);
+                        Real radius = radius_arr(i,j,k);
+                        int index = round(cc_to_r(i,j,k));
 
                         Real rfac;
-                        if (index < base_geom.nr_fine) {
+                        if (index < nr_fine) {
                             rfac = (radius - r_edge_loc(0,index+1)) 
                             / (r_cc_loc(0,index+1) 
                                 - r_cc_loc(0,index));
@@ -457,7 +190,7 @@ Maestro::Put1dArrayOnCart (int lev,
                                 - r_cc_loc(0,index-1));
                         }
 
-                        Real s0_cart_val;
+                        Real s0_cart_val = s0(0,index);
 
                         if (w0_interp_type_loc == 1) {
 
@@ -511,8 +244,8 @@ Maestro::Put1dArrayOnCart (int lev,
                         Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
-                        int index = cc_to_r(i,j,k);
+                        Real radius = radius_arr(i,j,k);
+                        int index = round(cc_to_r(i,j,k));
 
                         Real s0_cart_val = s0(0,index);
                         
@@ -543,7 +276,7 @@ Maestro::Put1dArrayOnCart (int lev,
                         Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
+                        Real radius = radius_arr(i,j,k);
 
                         int index = int(radius / drf);
                         Real rfac = (radius - Real(index) * drf) / drf;
@@ -608,7 +341,7 @@ Maestro::Put1dArrayOnCart (int lev,
                         Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
+                        Real radius = radius_arr(i,j,k);
                         int index = int(radius / drf);
 
                         Real s0_cart_val = 0.0;
@@ -670,6 +403,79 @@ Maestro::Put1dArrayOnCart (int lev,
     }
 }
 
+
+BaseStateCart
+Maestro::MakeBaseStateCart (const int lev,
+                            const MFIter& mfi,
+                            const RealVector& s0,
+                            const int is_input_edge_centered)
+{
+    BaseStateCart s0_cart = MakeBaseStateCart(lev, mfi, is_input_edge_centered);
+
+    const int max_lev = base_geom.max_radial_level+1;
+    const auto s0_arr = makeRadialBaseStateArray(s0, max_lev, s0.size()/max_lev);
+
+    s0_cart.s0 = s0_arr.dptr;
+    s0_cart.lev_stride = s0_arr.lev_stride;
+    s0_cart.r_stride = s0_arr.r_stride;
+
+    return s0_cart;
+}
+
+BaseStateCart
+Maestro::MakeBaseStateCart (const int lev,
+                            const MFIter& mfi,
+                            const BaseState<Real>& s0,
+                            const int is_input_edge_centered)
+{
+    BaseStateCart s0_cart = MakeBaseStateCart(lev, mfi, is_input_edge_centered);
+
+    const auto s0_arr = s0.const_array();
+
+    s0_cart.s0 = s0_arr.dptr;
+    s0_cart.lev_stride = s0_arr.lev_stride;
+    s0_cart.r_stride = s0_arr.r_stride;
+
+    return s0_cart;
+}
+
+// fill in everything but the 1d data itself
+BaseStateCart
+Maestro::MakeBaseStateCart (const int lev,
+                            const MFIter& mfi,
+                            const int is_input_edge_centered)
+{
+    BaseStateCart s0_cart;
+
+    s0_cart.s0 = nullptr;
+    s0_cart.lev_stride = 0;
+    s0_cart.r_stride = 0;
+
+    s0_cart.lev = lev;
+    s0_cart.spherical = spherical;
+    s0_cart.use_exact_base_state = use_exact_base_state;
+    s0_cart.is_input_edge_centered = is_input_edge_centered;
+    s0_cart.interp_type = is_input_edge_centered ? w0_interp_type : s0_interp_type;
+    s0_cart.nr_fine = base_geom.nr_fine;
+    s0_cart.dr_fine = base_geom.dr_fine;
+
+    s0_cart.r_cc_loc = base_geom.r_cc_loc.ptr(0);
+    s0_cart.r_edge_loc = base_geom.r_edge_loc.ptr(0);
+
+    if (spherical) {
+        s0_cart.cell_radius = cell_radius[lev].const_array(mfi);
+    }
+    if (spherical && use_exact_base_state) {
+        s0_cart.cc_to_r = cell_cc_to_r[lev].const_array(mfi);
+    }
+
+    s0_cart.dx = geom[lev].CellSizeArray();
+    s0_cart.prob_lo = geom[lev].ProbLoArray();
+    s0_cart.center = center;
+
+    return s0_cart;
+}
+
 AMREX_GPU_DEVICE 
 Real
 Maestro::QuadInterp(const Real x, const Real x0, const Real x1, const Real x2,
@@ -2117,4 +1923,65 @@ Maestro::MakeCCtoRadii ()
         }
     }
 }
-#endif
\ No newline at end of file
+#endif
+// build the spherical radial map for level lev on grids ba/dm: the
+// distance from the center to every cell center, and the irregular
+// radial bin (as used by Average) that the cell center falls in.  These
+// depend only on the geometry, so we compute them once per level here
+// instead of on every call to the mapping and averaging routines
+void
+Maestro::MakeRadialMap (const int lev,
+                        const BoxArray& ba,
+                        const DistributionMapping& dm)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeRadialMap()", MakeRadialMap);
+
+    if (!spherical) {
+        return;
+    }
+
+    cell_radius[lev].define(ba, dm, 1, 0);
+    cell_irreg_r[lev].define(ba, dm, 1, 0);
+
+#if (AMREX_SPACEDIM == 3)
+    const auto dx = geom[lev].CellSizeArray();
+    const auto prob_lo = geom[lev].ProbLoArray();
+    const auto center_p = center;
+    const int nr_irreg = base_geom.nr_irreg;
+
+    // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(cell_radius[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+
+        const Box& tileBox = mfi.tilebox();
+        const Array4<Real> radius_arr = cell_radius[lev].array(mfi);
+        const Array4<int> irreg_r_arr = cell_irreg_r[lev].array(mfi);
+
+        AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
+            Real x = prob_lo[0] + (Real(i)+0.5) * dx[0] - center_p[0];
+            Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
+            Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
+
+            Real radius = sqrt(x*x + y*y + z*z);
+
+            // figure out which radii index this point maps into
+            int index = std::round( ((radius/dx[0])*(radius/dx[0]) - 0.75) / 2.0 );
+
+            // due to roundoff error, need to ensure that we are in the proper radial bin
+            if (index < nr_irreg) {
+                Real radius_lo = std::sqrt(0.75+2.0*Real(index)) * dx[0];
+                Real radius_hi = std::sqrt(0.75+2.0*Real(index+1)) * dx[0];
+                if (fabs(radius-radius_lo) > fabs(radius-radius_hi)) {
+                    index++;
+                }
+            }
+
+            radius_arr(i,j,k) = radius;
+            irreg_r_arr(i,j,k) = index;
+        });
+    }
+#endif
+}
@@ -786,6 +786,8 @@ Maestro::MakeTempForce(Vector<MultiFab>& temp_force,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeTempForce()",MakeTempForce);
 
+    ThermoCacheDefine();
+
     // if we are doing the prediction, then it only makes sense to be in
     // this routine if the quantity we are predicting is rhoh', h, or rhoh
     if (!(enthalpy_pred_type == predict_T_then_rhohprime ||
@@ -817,6 +819,7 @@ Maestro::MakeTempForce(Vector<MultiFab>& temp_force,
 
             // Get the index space of the valid region
             const Box& tileBox = mfi.tilebox();
+            const Array4<ThermoCacheEntry> thermo_cache_arr = ThermoCacheArray(lev, mfi);
             const Box& domainBox = geom[lev].Domain();
             const auto domlo = domainBox.loVect3d();
             const auto domhi = domainBox.hiVect3d();
@@ -864,7 +867,7 @@ Maestro::MakeTempForce(Vector<MultiFab>& temp_force,
                     }
 
                     // dens, temp, xmass inputs
-                    eos(eos_input_rt, eos_state);
+                    eos_rt_cached(thermo_cache_arr, i, j, k, eos_state);
 
                     auto dhdp = 1.0 / scal_arr(i,j,k,Rho) + 
                         (scal_arr(i,j,k,Rho) * eos_state.dedr - 
@@ -894,7 +897,7 @@ Maestro::MakeTempForce(Vector<MultiFab>& temp_force,
                     }
 
                     // dens, temp, xmass inputs
-                    eos(eos_input_rt, eos_state);
+                    eos_rt_cached(thermo_cache_arr, i, j, k, eos_state);
 
                     auto dhdp = 1.0 / scal_arr(i,j,k,Rho) + 
                         (scal_arr(i,j,k,Rho) * eos_state.dedr - 
@@ -8,66 +8,88 @@ void
 Maestro::MakeGamma1bar (const Vector<MultiFab>& scal,
                         RealVector& gamma1bar,
                         const RealVector& p0)
+{
+    MakeGamma1bar({&scal}, {&gamma1bar}, {&p0});
+}
+
+// compute gamma1bar_batch[ib] from scal_batch[ib] and p0_batch[ib] for
+// every ib, averaging the whole batch with a single reduction
+void
+Maestro::MakeGamma1bar (const Vector<const Vector<MultiFab>*>& scal_batch,
+                        const Vector<RealVector*>& gamma1bar_batch,
+                        const Vector<const RealVector*>& p0_batch)
 {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeGamma1bar()", MakeGamma1bar);
 
-    Vector<MultiFab> gamma1(finest_level+1);
-    Vector<MultiFab> p0_cart(finest_level+1);
+    AMREX_ASSERT(scal_batch.size() == gamma1bar_batch.size());
+    AMREX_ASSERT(scal_batch.size() == p0_batch.size());
 
-    for (int lev=0; lev<=finest_level; ++lev) {
-        gamma1[lev].define(grids[lev], dmap[lev], 1, 1);
-        gamma1[lev].setVal(0.);
+    const int nbatch = scal_batch.size();
 
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 1);
-        p0_cart[lev].setVal(0.);
-    }
-
-    Put1dArrayOnCart(p0, p0_cart, 0, 0, bcs_f, 0);
+    Vector<Vector<MultiFab> > gamma1_batch(nbatch);
 
     const auto use_pprime_in_tfromp_loc = use_pprime_in_tfromp;
 
-    for (int lev=0; lev<=finest_level; ++lev) {
+    for (int ib = 0; ib < nbatch; ++ib) {
+
+        const Vector<MultiFab>& scal = *scal_batch[ib];
+        const RealVector& p0 = *p0_batch[ib];
+        Vector<MultiFab>& gamma1 = gamma1_batch[ib];
 
-        // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+        gamma1.resize(finest_level+1);
+
+        for (int lev=0; lev<=finest_level; ++lev) {
+            gamma1[lev].define(grids[lev], dmap[lev], 1, 1);
+            gamma1[lev].setVal(0.);
+        }
+
+        for (int lev=0; lev<=finest_level; ++lev) {
+
+            // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
-        for (MFIter mfi(gamma1[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            for (MFIter mfi(gamma1[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
 
-            // Get the index space of the valid region
-            const Box& tileBox = mfi.tilebox();
+                // Get the index space of the valid region
+                const Box& tileBox = mfi.tilebox();
 
-            const Array4<Real> gamma1_arr = gamma1[lev].array(mfi);
-            const Array4<const Real> scal_arr = scal[lev].array(mfi);
-            const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
+                const Array4<Real> gamma1_arr = gamma1[lev].array(mfi);
+                const Array4<const Real> scal_arr = scal[lev].array(mfi);
+                const auto p0_arr = MakeBaseStateCart(lev, mfi, p0, 0);
 
-            AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
-                eos_t eos_state;
+                AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
+                    eos_t eos_state;
 
-                eos_state.rho = scal_arr(i,j,k,Rho);
+                    eos_state.rho = scal_arr(i,j,k,Rho);
 
-                if (use_pprime_in_tfromp_loc) {
-                    eos_state.p = p0_arr(i,j,k) + scal_arr(i,j,k,Pi);
-                } else {
-                    eos_state.p = p0_arr(i,j,k);
-                }
-                eos_state.T = scal_arr(i,j,k,Temp);
-                for (auto n = 0; n < NumSpec; ++n) {
-                    eos_state.xn[n] = scal_arr(i,j,k,FirstSpec+n) / eos_state.rho;
-                }
+                    if (use_pprime_in_tfromp_loc) {
+                        eos_state.p = p0_arr(i,j,k) + scal_arr(i,j,k,Pi);
+                    } else {
+                        eos_state.p = p0_arr(i,j,k);
+                    }
+                    eos_state.T = scal_arr(i,j,k,Temp);
+                    for (auto n = 0; n < NumSpec; ++n) {
+                        eos_state.xn[n] = scal_arr(i,j,k,FirstSpec+n) / eos_state.rho;
+                    }
 
-                // dens, pres, and xmass are inputs
-                eos(eos_input_rp, eos_state);
+                    // dens, pres, and xmass are inputs
+                    eos(eos_input_rp, eos_state);
 
-                gamma1_arr(i,j,k) = eos_state.gam1;
-            });
+                    gamma1_arr(i,j,k) = eos_state.gam1;
+                });
+            }
         }
-    }
 
-    // average fine data onto coarser cells
-    AverageDown(gamma1, 0, 1);
+        // average fine data onto coarser cells
+        AverageDown(gamma1, 0, 1);
+    }
 
     // call average to create gamma1bar
-    Average(gamma1, gamma1bar, 0);
+    Vector<const Vector<MultiFab>*> gamma1_ptrs(nbatch);
+    for (int ib = 0; ib < nbatch; ++ib) {
+        gamma1_ptrs[ib] = &gamma1_batch[ib];
+    }
+    Average(gamma1_ptrs, gamma1bar_batch, Vector<int>(nbatch, 0));
 }
@@ -73,6 +73,7 @@ Maestro::Init ()
                 normal[lev].define(grids[lev], dmap[lev], 3, 1);
                 cell_cc_to_r[lev].define(grids[lev], dmap[lev], 1, 0);
             }
+            MakeRadialMap(lev, grids[lev], dmap[lev]);
             pi[lev].define(convert(grids[lev],nodal_flag), dmap[lev], 1, 0); // nodal
 #ifdef SDC
             intra[lev].define(grids[lev], dmap[lev], Nscal, 0); // for sdc
@@ -100,13 +101,11 @@ Maestro::Init ()
         // compute numdisjointchunks, r_start_coord, r_end_coord
         init_multilevel(tag_array.dataPtr(),&finest_level);
         // InitMultilevel(finest_level);
-        BaseState<int> tag_array_b(tag_array, base_geom.max_radial_level+1, base_geom.nr_fine);
-        base_geom.InitMultiLevel(finest_level, tag_array_b.array());
+        base_geom.InitMultiLevel(finest_level,
+            makeRadialBaseStateArray(tag_array, base_geom.max_radial_level+1, base_geom.nr_fine));
 
         compute_cutoff_coords(rho0_old.dataPtr());
         ComputeCutoffCoords(rho0_old);
-        BaseState<Real> rho0_state(rho0_old, base_geom.max_radial_level+1, base_geom.nr_fine);
-        base_geom.ComputeCutoffCoords(rho0_state.array());
     }
 
 #if (AMREX_SPACEDIM == 3)
@@ -250,8 +249,8 @@ Maestro::InitData ()
     // compute numdisjointchunks, r_start_coord, r_end_coord
     init_multilevel(tag_array.dataPtr(),&finest_level);
     // InitMultilevel(finest_level);
-    BaseState<int> tag_array_b(tag_array, base_geom.max_radial_level+1, base_geom.nr_fine);
-    base_geom.InitMultiLevel(finest_level, tag_array_b.array());
+    base_geom.InitMultiLevel(finest_level,
+        makeRadialBaseStateArray(tag_array, base_geom.max_radial_level+1, base_geom.nr_fine));
 
     // average down data and fill ghost cells
     AverageDown(sold,0,Nscal);
@@ -269,28 +268,25 @@ Maestro::InitData ()
         // compute cutoff coordinates
         compute_cutoff_coords(rho0_old.dataPtr());
         ComputeCutoffCoords(rho0_old);
-        BaseState<Real> rho0_state(rho0_old, base_geom.max_radial_level+1, base_geom.nr_fine);
-        base_geom.ComputeCutoffCoords(rho0_state.array());
         MakeGravCell(grav_cell_old, rho0_old);
     } else {
 
         // first compute cutoff coordinates using initial density profile
         compute_cutoff_coords(rho0_old.dataPtr());
         ComputeCutoffCoords(rho0_old);
-        BaseState<Real> rho0_state(rho0_old, base_geom.max_radial_level+1, base_geom.nr_fine);
-        base_geom.ComputeCutoffCoords(rho0_state.array());
 
         if (do_smallscale) {
             // set rho0_old = rhoh0_old = 0.
             std::fill(rho0_old.begin(),  rho0_old.end(),  0.);
             std::fill(rhoh0_old.begin(), rhoh0_old.end(), 0.);
+
+            // set tempbar to be the average
+            Average(sold,tempbar,Temp);
         } else {
             // set rho0 to be the average
             Average(sold,rho0_old,Rho);
             compute_cutoff_coords(rho0_old.dataPtr());
             ComputeCutoffCoords(rho0_old);
-            BaseState<Real> rho0_state(rho0_old, base_geom.max_radial_level+1, base_geom.nr_fine);
-            base_geom.ComputeCutoffCoords(rho0_state.array());
 
             // compute gravity
             MakeGravCell(grav_cell_old, rho0_old);
@@ -301,12 +297,10 @@ Maestro::InitData ()
             // call eos with r,p as input to recompute T,h
             TfromRhoP(sold,p0_old,1);
 
-            // set rhoh0 to be the average
-            Average(sold,rhoh0_old,RhoH);
+            // set rhoh0 and tempbar to be the averages
+            Average({&sold, &sold}, {&rhoh0_old, &tempbar}, {RhoH, Temp});
         }
 
-        // set tempbar to be the average
-        Average(sold,tempbar,Temp);
         for (int i=0; i<tempbar.size(); ++i) {
             tempbar_init[i] = tempbar[i];
         }
@@ -343,6 +337,7 @@ void Maestro::MakeNewLevelFromScratch (int lev, Real time, const BoxArray& ba,
 
     pi[lev].define(convert(ba,nodal_flag), dm, 1, 0); // nodal
     intra[lev].define(ba, dm, Nscal, 0); // for sdc
+    burn_cost         [lev].define(ba, dm,              1,    0);
 
     sold              [lev].setVal(0.);
     snew              [lev].setVal(0.);
@@ -356,11 +351,13 @@ void Maestro::MakeNewLevelFromScratch (int lev, Real time, const BoxArray& ba,
     rhcc_for_nodalproj[lev].setVal(0.);
     pi                [lev].setVal(0.);
     intra             [lev].setVal(0.);
+    burn_cost         [lev].setVal(0.);
 
     if (spherical == 1) {
         normal      [lev].define(ba, dm, 3, 1);
         cell_cc_to_r[lev].define(ba, dm, 1, 0);
     }
+    MakeRadialMap(lev, ba, dm);
 
     const Real* dx = geom[lev].CellSize();
     const Real* dx_fine = geom[max_level].CellSize();
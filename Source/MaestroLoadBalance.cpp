@@ -0,0 +1,109 @@
+#include <Maestro.H>
+
+using namespace amrex;
+
+// add the wallclock time spent burning box bx of FAB idx to the cost of
+// its cells.  The time is spread evenly over bx, so that the cost can
+// later be carried over to a different BoxArray cell by cell
+void
+Maestro::RecordBurnCost (const int lev, const int idx, const Box& bx, const Real wt)
+{
+    if (load_balance_type == 0 || Gpu::inLaunchRegion()) {
+        return;
+    }
+
+    burn_cost[lev][idx].plus<RunOn::Host>(wt/bx.numPts(), bx, 0, 1);
+}
+
+// build the DistributionMapping for a new BoxArray at level lev.
+// overrides the virtual function in AmrMesh, which is called by
+// AmrCore::regrid and AmrCore::InitFromScratch.  If we have not measured
+// any burner cost on this level yet, we fall back to the AMReX default
+DistributionMapping
+Maestro::MakeDistributionMap (int lev, const BoxArray& ba)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeDistributionMap()", MakeDistributionMap);
+
+    if (load_balance_type == 0 || lev >= burn_cost.size() || !burn_cost[lev].ok()) {
+        return AmrCore::MakeDistributionMap(lev, ba);
+    }
+
+    // carry the measured cost over to the new grids, cell by cell.  Cells
+    // that were not covered by the old grids get the mean cost of the
+    // level, since we have no measurement there
+    const Real mean_cost = burn_cost[lev].sum(0) / burn_cost[lev].boxArray().numPts();
+
+    DistributionMapping dm_tmp(ba);
+    MultiFab cost(ba, dm_tmp, 1, 0);
+    cost.setVal(mean_cost);
+    cost.ParallelCopy(burn_cost[lev], 0, 0, 1);
+
+    return MakeWeightedDistributionMap(ba, cost);
+}
+
+// distribute the boxes of ba over the ranks by weight, where the weight
+// of each box is the burner cost of its cells plus a share of the mean
+// cost that is spread uniformly over all the cells of the level.  The
+// uniform part stands in for the advection and projections, whose cost
+// is roughly proportional to the number of cells, and keeps inert boxes
+// from being treated as free
+DistributionMapping
+Maestro::MakeWeightedDistributionMap (const BoxArray& ba, const MultiFab& cost)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeWeightedDistributionMap()", MakeWeightedDistributionMap);
+
+    const int nboxes = ba.size();
+    const int nprocs = ParallelDescriptor::NProcs();
+
+    // the total cost in each box, summed over the locally owned boxes
+    // and then shared with every rank
+    Vector<Real> box_cost(nboxes, 0.0);
+    for (MFIter mfi(cost); mfi.isValid(); ++mfi) {
+        box_cost[mfi.index()] = cost[mfi].sum<RunOn::Host>(mfi.validbox(), 0);
+    }
+    ParallelDescriptor::ReduceRealSum(box_cost.dataPtr(), nboxes);
+
+    Real total_cost = 0.0;
+    for (int i = 0; i < nboxes; ++i) {
+        total_cost += box_cost[i];
+    }
+
+    if (total_cost <= 0.0) {
+        return DistributionMapping(ba, nprocs);
+    }
+
+    const Real cost_per_cell = total_cost / ba.numPts();
+
+    // the knapsack and SFC algorithms take integer weights, so scale the
+    // costs so that the most expensive box has a weight of about 1e9
+    Vector<Real> wgt(nboxes);
+    Real max_wgt = 0.0;
+    for (int i = 0; i < nboxes; ++i) {
+        wgt[i] = box_cost[i] + cost_per_cell * ba[i].numPts();
+        max_wgt = std::max(max_wgt, wgt[i]);
+    }
+
+    std::vector<Long> lwgt(nboxes);
+    for (int i = 0; i < nboxes; ++i) {
+        lwgt[i] = static_cast<Long>(1.e9 * wgt[i] / max_wgt) + 1;
+    }
+
+    DistributionMapping dm;
+    Real efficiency = 0.0;
+    if (load_balance_type == 1) {
+        dm.KnapSackProcessorMap(lwgt, nprocs, &efficiency);
+    } else if (load_balance_type == 2) {
+        dm.SFCProcessorMap(ba, lwgt, nprocs, efficiency);
+    } else {
+        Abort("MakeWeightedDistributionMap: invalid load_balance_type");
+    }
+
+    if (maestro_verbose > 0) {
+        Print() << "Load balancing " << nboxes << " boxes by burner cost, efficiency = "
+                << efficiency << '\n';
+    }
+
+    return dm;
+}
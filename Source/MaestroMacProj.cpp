@@ -122,17 +122,10 @@ Maestro::MacProj(Vector<std::array< MultiFab, AMREX_SPACEDIM > >& umac,
     }
 
     //
-    // Set up implicit solve using MLABecLaplacian class
+    // Set up implicit solve using the persistent MLABecLaplacian, which
+    // already holds the stencil order and velocity bc's
     //
-    LPInfo info;
-    MLABecLaplacian mlabec(geom, grids, dmap, info);
-
-    // order of stencil
-    int linop_maxorder = 2;
-    mlabec.setMaxOrder(linop_maxorder);
-
-    // set boundaries for mlabec using velocity bc's
-    SetMacSolverBCs(mlabec);
+    MLABecLaplacian& mlabec = MacLinOp();
 
     for (int lev = 0; lev <= finest_level; ++lev) {
         mlabec.setLevelBC(lev, &macphi[lev]);
@@ -153,13 +146,16 @@ Maestro::MacProj(Vector<std::array< MultiFab, AMREX_SPACEDIM > >& umac,
     // set solver parameters
     mac_mlmg.setVerbose(mg_verbose);
     mac_mlmg.setCGVerbose(cg_verbose);
+    SetMLMGOptions(mac_mlmg, mac_tuner.Config());
 
     // tolerance parameters taken from original MAESTRO fortran code
     const Real mac_tol_abs = -1.e0;
     const Real mac_tol_rel = std::min(eps_mac*pow(mac_level_factor,finest_level), eps_mac_max);
 
     // solve for phi
+    const Real solve_start = ParallelDescriptor::second();
     mac_mlmg.solve(GetVecOfPtrs(macphi), GetVecOfConstPtrs(solverrhs), mac_tol_rel, mac_tol_abs);
+    SolverTuneRecord(mac_tuner, solve_start, "MAC");
 
     // update velocity, beta0 * Utilde = beta0 * Utilde^* - B grad phi
 
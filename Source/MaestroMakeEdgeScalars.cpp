@@ -17,6 +17,12 @@ Maestro::MakeEdgeScal (Vector<MultiFab>& state,
 
     for (int lev=0; lev<=finest_level; ++lev) {
 
+        if (edge_scal_tile_scratch) {
+            MakeEdgeScalTile(lev, state, sedge, umac, force, is_vel, bcs,
+                             start_scomp, start_bccomp, num_comp, is_conservative);
+            continue;
+        }
+
         // Get the index space and grid spacing of the domain
         const Box& domainBox = geom[lev].Domain();
         const auto dx = geom[lev].CellSizeArray();
@@ -350,6 +356,308 @@ Maestro::MakeEdgeScal (Vector<MultiFab>& state,
     }
 }
 
+void
+Maestro::MakeEdgeScalTile (const int lev,
+                           Vector<MultiFab>& state,
+                           Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sedge,
+                           Vector<std::array< MultiFab, AMREX_SPACEDIM > >& umac,
+                           Vector<MultiFab>& force,
+                           int is_vel, const Vector<BCRec>& bcs,
+                           int start_scomp, int start_bccomp, int num_comp, int is_conservative)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeEdgeScalTile()", MakeEdgeScalTile);
+
+    // Get the index space and grid spacing of the domain
+    const Box& domainBox = geom[lev].Domain();
+    const auto dx = geom[lev].CellSizeArray();
+
+    // get references to the MultiFabs at level lev
+    const MultiFab& scal_mf = state[lev];
+
+    // the slope routines work on a single-component array, so they
+    // still need a level-wide copy of each component
+    Vector<MultiFab> vec_scal_mf(num_comp);
+    if (ppm_type == 0) {
+        for (int comp=0; comp < num_comp; ++comp) {
+            vec_scal_mf[comp].define(grids[lev],dmap[lev],1,scal_mf.nGrow());
+            vec_scal_mf[comp].setVal(0.);
+
+            MultiFab::Copy(vec_scal_mf[comp], scal_mf, start_scomp+comp, 0, 1, scal_mf.nGrow());
+        }
+    }
+
+    // Every stage of the prediction only reads the temporaries inside
+    // the tile box grown by one cell, so all of them can be held in
+    // per-thread FABs over that box and the stages fused into a single
+    // pass over the tiles.
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        FArrayBox Ip, Im, Ipf, Imf;
+        FArrayBox slx, srx, simhx;
+        FArrayBox sly, sry, simhy;
+#if (AMREX_SPACEDIM == 3)
+        FArrayBox slopez, divu;
+        FArrayBox slz, srz, simhz;
+        FArrayBox simhxy, simhxz, simhyx, simhyz, simhzx, simhzy;
+#endif
+
+        for ( MFIter mfi(scal_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
+
+            // Get the index space of the valid region
+            const Box& tileBox = mfi.tilebox();
+            const Box& obx = amrex::grow(tileBox, 1);
+
+            Ip.resize(obx,AMREX_SPACEDIM);
+            Elixir e_Ip = Ip.elixir();
+            Im.resize(obx,AMREX_SPACEDIM);
+            Elixir e_Im = Im.elixir();
+            Ipf.resize(obx,AMREX_SPACEDIM);
+            Elixir e_Ipf = Ipf.elixir();
+            Imf.resize(obx,AMREX_SPACEDIM);
+            Elixir e_Imf = Imf.elixir();
+
+            slx.resize(obx,1);
+            Elixir e_slx = slx.elixir();
+            srx.resize(obx,1);
+            Elixir e_srx = srx.elixir();
+            simhx.resize(obx,1);
+            Elixir e_simhx = simhx.elixir();
+            sly.resize(obx,1);
+            Elixir e_sly = sly.elixir();
+            sry.resize(obx,1);
+            Elixir e_sry = sry.elixir();
+            simhy.resize(obx,1);
+            Elixir e_simhy = simhy.elixir();
+
+#if (AMREX_SPACEDIM == 3)
+            slopez.resize(obx,1);
+            Elixir e_slopez = slopez.elixir();
+            divu.resize(obx,1);
+            Elixir e_divu = divu.elixir();
+
+            slz.resize(obx,1);
+            Elixir e_slz = slz.elixir();
+            srz.resize(obx,1);
+            Elixir e_srz = srz.elixir();
+            simhz.resize(obx,1);
+            Elixir e_simhz = simhz.elixir();
+
+            simhxy.resize(obx,1);
+            Elixir e_simhxy = simhxy.elixir();
+            simhxz.resize(obx,1);
+            Elixir e_simhxz = simhxz.elixir();
+            simhyx.resize(obx,1);
+            Elixir e_simhyx = simhyx.elixir();
+            simhyz.resize(obx,1);
+            Elixir e_simhyz = simhyz.elixir();
+            simhzx.resize(obx,1);
+            Elixir e_simhzx = simhzx.elixir();
+            simhzy.resize(obx,1);
+            Elixir e_simhzy = simhzy.elixir();
+#endif
+
+            slx.setVal<RunOn::Device>(0.0);
+            srx.setVal<RunOn::Device>(0.0);
+            simhx.setVal<RunOn::Device>(0.0);
+            sly.setVal<RunOn::Device>(0.0);
+            sry.setVal<RunOn::Device>(0.0);
+            simhy.setVal<RunOn::Device>(0.0);
+#if (AMREX_SPACEDIM == 3)
+            slz.setVal<RunOn::Device>(0.0);
+            srz.setVal<RunOn::Device>(0.0);
+            simhz.setVal<RunOn::Device>(0.0);
+
+            simhxy.setVal<RunOn::Device>(0.0);
+            simhxz.setVal<RunOn::Device>(0.0);
+            simhyx.setVal<RunOn::Device>(0.0);
+            simhyz.setVal<RunOn::Device>(0.0);
+            simhzx.setVal<RunOn::Device>(0.0);
+            simhzy.setVal<RunOn::Device>(0.0);
+#endif
+
+            Array4<Real> const scal_arr = state[lev].array(mfi);
+
+            Array4<Real> const umac_arr = umac[lev][0].array(mfi);
+            Array4<Real> const vmac_arr = umac[lev][1].array(mfi);
+#if (AMREX_SPACEDIM == 3)
+            Array4<Real> const wmac_arr = umac[lev][2].array(mfi);
+#endif
+
+            Array4<Real> const Ip_arr = Ip.array();
+            Array4<Real> const Im_arr = Im.array();
+            Array4<Real> const Ipf_arr = Ipf.array();
+            Array4<Real> const Imf_arr = Imf.array();
+
+            Array4<Real> const slx_arr = slx.array();
+            Array4<Real> const srx_arr = srx.array();
+            Array4<Real> const sly_arr = sly.array();
+            Array4<Real> const sry_arr = sry.array();
+
+            Array4<Real> const simhx_arr = simhx.array();
+            Array4<Real> const simhy_arr = simhy.array();
+
+#if (AMREX_SPACEDIM == 3)
+            Array4<Real> const slopez_arr = slopez.array();
+            Array4<Real> const divu_arr = divu.array();
+
+            Array4<Real> const slz_arr = slz.array();
+            Array4<Real> const srz_arr = srz.array();
+            Array4<Real> const simhz_arr = simhz.array();
+
+            Array4<Real> const simhxy_arr = simhxy.array();
+            Array4<Real> const simhxz_arr = simhxz.array();
+            Array4<Real> const simhyx_arr = simhyx.array();
+            Array4<Real> const simhyz_arr = simhyz.array();
+            Array4<Real> const simhzx_arr = simhzx.array();
+            Array4<Real> const simhzy_arr = simhzy.array();
+#endif
+
+            Array4<Real> const sedgex_arr = sedge[lev][0].array(mfi);
+            Array4<Real> const sedgey_arr = sedge[lev][1].array(mfi);
+#if (AMREX_SPACEDIM == 3)
+            Array4<Real> const sedgez_arr = sedge[lev][2].array(mfi);
+
+            // make divu
+            if (is_conservative) {
+                MakeDivU(obx, divu_arr,
+                         umac_arr, vmac_arr, wmac_arr, dx);
+            }
+#endif
+
+            // Be careful to pass in comp+1 for fortran indexing
+            for (int scomp = start_scomp; scomp < start_scomp + num_comp; ++scomp) {
+
+                int vcomp = scomp - start_scomp;
+                int bccomp = start_bccomp + scomp - start_scomp;
+
+
+                if (ppm_type == 0) {
+                    // we're going to reuse Ip here as slopex and Im as slopey
+                    // as they have the correct number of ghost zones
+
+                    // x-direction
+                    Slopex(obx, vec_scal_mf[vcomp].array(mfi),
+                           Ip_arr,
+                           domainBox, bcs,
+                           1,bccomp);
+
+                    // y-direction
+                    Slopey(obx, vec_scal_mf[vcomp].array(mfi),
+                           Im_arr,
+                           domainBox, bcs,
+                           1,bccomp);
+
+#if (AMREX_SPACEDIM == 3)
+                    // z-direction
+                    Slopez(obx, vec_scal_mf[vcomp].array(mfi),
+                           slopez_arr,
+                           domainBox, bcs,
+                           1,bccomp);
+#endif
+
+                } else {
+
+                    PPM(obx, scal_arr,
+                        umac_arr, vmac_arr,
+#if (AMREX_SPACEDIM == 3)
+                        wmac_arr,
+#endif
+                        Ip_arr, Im_arr,
+                        domainBox, bcs, dx,
+                        true, scomp, bccomp);
+
+                    if (ppm_trace_forces == 1) {
+
+                        PPM(obx, force[lev].array(mfi),
+                            umac_arr, vmac_arr,
+#if (AMREX_SPACEDIM == 3)
+                            wmac_arr,
+#endif
+                            Ipf_arr, Imf_arr,
+                            domainBox, bcs, dx,
+                            true, scomp, bccomp);
+                    }
+                }
+
+#if (AMREX_SPACEDIM == 2)
+
+                // Create s_{\i-\half\e_x}^x, etc.
+
+                MakeEdgeScalPredictor(mfi, slx_arr, srx_arr,
+                                      sly_arr, sry_arr,
+                                      scal_arr,
+                                      Ip_arr, Im_arr,
+                                      umac_arr, vmac_arr,
+                                      simhx_arr, simhy_arr,
+                                      domainBox, bcs, dx,
+                                      scomp, bccomp, is_vel);
+
+                // Create sedgelx, etc.
+
+                MakeEdgeScalEdges(mfi, slx_arr, srx_arr,
+                                  sly_arr, sry_arr,
+                                  scal_arr,
+                                  sedgex_arr, sedgey_arr,
+                                  force[lev].array(mfi),
+                                  umac_arr, vmac_arr,
+                                  Ipf_arr, Imf_arr,
+                                  simhx_arr, simhy_arr,
+                                  domainBox, bcs, dx,
+                                  scomp, bccomp,
+                                  is_vel, is_conservative);
+
+#elif (AMREX_SPACEDIM == 3)
+
+                // Create s_{\i-\half\e_x}^x, etc.
+
+                MakeEdgeScalPredictor(mfi, slx_arr, srx_arr,
+                                      sly_arr, sry_arr,
+                                      slz_arr, srz_arr,
+                                      scal_arr,
+                                      Ip_arr, Im_arr,
+                                      slopez_arr,
+                                      umac_arr, vmac_arr, wmac_arr,
+                                      simhx_arr, simhy_arr, simhz_arr,
+                                      domainBox, bcs, dx,
+                                      scomp, bccomp, is_vel);
+
+                // Create transverse terms, s_{\i-\half\e_x}^{x|y}, etc.
+
+                MakeEdgeScalTransverse(mfi, slx_arr, srx_arr,
+                                       sly_arr, sry_arr,
+                                       slz_arr, srz_arr,
+                                       scal_arr, divu_arr,
+                                       umac_arr, vmac_arr, wmac_arr,
+                                       simhx_arr, simhy_arr, simhz_arr,
+                                       simhxy_arr, simhxz_arr, simhyx_arr,
+                                       simhyz_arr, simhzx_arr, simhzy_arr,
+                                       domainBox, bcs, dx,
+                                       scomp, bccomp,
+                                       is_vel, is_conservative);
+
+                // Create sedgelx, etc.
+
+                MakeEdgeScalEdges(mfi, slx_arr, srx_arr,
+                                  sly_arr, sry_arr,
+                                  slz_arr, srz_arr, scal_arr,
+                                  sedgex_arr, sedgey_arr, sedgez_arr,
+                                  force[lev].array(mfi),
+                                  umac_arr, vmac_arr, wmac_arr,
+                                  Ipf_arr, Imf_arr,
+                                  simhxy_arr, simhxz_arr, simhyx_arr,
+                                  simhyz_arr, simhzx_arr, simhzy_arr,
+                                  domainBox, bcs, dx,
+                                  scomp, bccomp,
+                                  is_vel, is_conservative);
+#endif
+            } // end loop over components
+        } // end MFIter loop
+    } // end omp parallel region
+}
+
 #if (AMREX_SPACEDIM == 2)
 
 void Maestro::MakeEdgeScalPredictor(const MFIter& mfi,
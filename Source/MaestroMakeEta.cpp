@@ -41,76 +41,136 @@ Maestro::MakeEtarho (const Vector<MultiFab>& etarho_flux)
             ncell[lev] = (domainBox.bigEnd(0)+1)*(domainBox.bigEnd(1)+1);
         }
 
-        // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
-#ifdef _OPENMP
-#pragma omp parallel if (!system::regtest_reduction)
-#endif
-        for ( MFIter mfi(sold[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
+        if (Gpu::inLaunchRegion()) {
 
-            // Get the index space of the valid tile region
-            const Box& tilebox = mfi.tilebox();
+            // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+            for ( MFIter mfi(sold[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
 
-            const Array4<const Real> etarhoflux_arr = etarho_flux[lev].array(mfi);
-            Real * AMREX_RESTRICT etarhosum_p = etarhosum.dataPtr();
+                // Get the index space of the valid tile region
+                const Box& tilebox = mfi.tilebox();
+
+                const Array4<const Real> etarhoflux_arr = etarho_flux[lev].array(mfi);
+                Real * AMREX_RESTRICT etarhosum_p = etarhosum.dataPtr();
 
 #if (AMREX_SPACEDIM == 2)
-            int zlo = tilebox.loVect3d()[2];
-            AMREX_PARALLEL_FOR_3D(tilebox, i, j, k, {
-                if (k == zlo) {
-                    amrex::HostDevice::Atomic::Add(&(etarhosum_p[lev+max_lev*j]), etarhoflux_arr(i,j,k));
+                int zlo = tilebox.loVect3d()[2];
+                AMREX_PARALLEL_FOR_3D(tilebox, i, j, k, {
+                    if (k == zlo) {
+                        amrex::HostDevice::Atomic::Add(&(etarhosum_p[lev+max_lev*j]), etarhoflux_arr(i,j,k));
+                    }
+                });
+            
+                // we only add the contribution at the top edge if we are at the top of the domain
+                // this prevents double counting
+                auto top_edge = false;
+                for (auto i = 1; i <= base_geom.numdisjointchunks(lev); ++i) {
+                    if (tilebox.hiVect3d()[1] == base_geom.r_end_coord(lev,i)) {
+                        top_edge = true;
+                    }
+                }
+
+                if (top_edge) {
+                    const int k = 0;
+                    const auto ybx = mfi.nodaltilebox(1);
+                    const int j = ybx.hiVect3d()[1];
+                    const int lo = ybx.loVect3d()[0];
+                    const int hi = ybx.hiVect3d()[0];
+
+                    AMREX_PARALLEL_FOR_1D(hi-lo+1, n, {
+                        int i = n + lo;
+                        amrex::HostDevice::Atomic::Add(&(etarhosum_p[lev+max_lev*j]), etarhoflux_arr(i,j,k));
+                    });
+                }
+#else 
+                AMREX_PARALLEL_FOR_3D(tilebox, i, j, k, {
+                    amrex::HostDevice::Atomic::Add(&(etarhosum_p[lev+max_lev*k]), etarhoflux_arr(i,j,k));
+                });
+
+                // we only add the contribution at the top edge if we are at the top of the domain
+                // this prevents double counting
+                auto top_edge = false;
+
+                for (auto i = 1; i <= base_geom.numdisjointchunks(lev); ++i) {
+                    if (tilebox.hiVect3d()[2] == base_geom.r_end_coord(lev,i)) {
+                        top_edge = true;
+                    }
                 }
-            });
             
-            // we only add the contribution at the top edge if we are at the top of the domain
-            // this prevents double counting
-            auto top_edge = false;
-            for (auto i = 1; i <= base_geom.numdisjointchunks(lev); ++i) {
-                if (tilebox.hiVect3d()[1] == base_geom.r_end_coord(lev,i)) {
-                    top_edge = true;
+                if (top_edge) {
+                    const auto zbx = mfi.nodaltilebox(2);
+                    int zhi = zbx.hiVect3d()[2];
+                    AMREX_PARALLEL_FOR_3D(zbx, i, j, k, {
+                        if (k == zhi) {
+                            amrex::HostDevice::Atomic::Add(&(etarhosum_p[lev+max_lev*k]), etarhoflux_arr(i,j,k));
+                        }
+                    });
                 }
+#endif
             }
 
-            if (top_edge) {
-                const int k = 0;
-                const auto ybx = mfi.nodaltilebox(1);
-                const int j = ybx.hiVect3d()[1];
-                const int lo = ybx.loVect3d()[0];
-                const int hi = ybx.hiVect3d()[0];
+        } else {
 
-                AMREX_PARALLEL_FOR_1D(hi-lo+1, n, {
-                    int i = n + lo;
-                    amrex::HostDevice::Atomic::Add(&(etarhosum_p[lev+max_lev*j]), etarhoflux_arr(i,j,k));
-                });
-            }
-#else 
-            AMREX_PARALLEL_FOR_3D(tilebox, i, j, k, {
-                amrex::HostDevice::Atomic::Add(&(etarhosum_p[lev+max_lev*k]), etarhoflux_arr(i,j,k));
-            });
+            // each tile sums into its own bins, which are then merged in a
+            // fixed order, so no atomics are needed and the result does not
+            // depend on the number of threads
+            TileBinSum<Real> tile_sum(sold[lev], TilingIfNotGPU());
 
-            // we only add the contribution at the top edge if we are at the top of the domain
-            // this prevents double counting
-            auto top_edge = false;
+            // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            for ( MFIter mfi(sold[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
+
+                // Get the index space of the valid tile region
+                const Box& tilebox = mfi.tilebox();
+                const auto lo = amrex::lbound(tilebox);
+                const auto hi = amrex::ubound(tilebox);
+
+                const Array4<const Real> etarhoflux_arr = etarho_flux[lev].array(mfi);
+
+                // the bins cover the top edge of the tile as well
+                const int r_lo = tilebox.smallEnd(AMREX_SPACEDIM-1);
+                const int r_hi = tilebox.bigEnd(AMREX_SPACEDIM-1);
+                Real* bin = tile_sum.Tile(mfi.LocalTileIndex(), r_lo, r_hi+1);
+
+                for (int k = lo.z; k <= hi.z; ++k) {
+                    for (int j = lo.y; j <= hi.y; ++j) {
+                        const int r = AMREX_SPACEDIM == 2 ? j : k;
+                        for (int i = lo.x; i <= hi.x; ++i) {
+                            bin[r-r_lo] += etarhoflux_arr(i,j,k);
+                        }
+                    }
+                }
 
-            for (auto i = 1; i <= base_geom.numdisjointchunks(lev); ++i) {
-                if (tilebox.hiVect3d()[2] == base_geom.r_end_coord(lev,i)) {
-                    top_edge = true;
+                // we only add the contribution at the top edge if we are at the top of the domain
+                // this prevents double counting
+                auto top_edge = false;
+                for (auto n = 1; n <= base_geom.numdisjointchunks(lev); ++n) {
+                    if (r_hi == base_geom.r_end_coord(lev,n)) {
+                        top_edge = true;
+                    }
                 }
-            }
-            
-            if (top_edge) {
-                const auto zbx = mfi.nodaltilebox(2);
-                int zhi = zbx.hiVect3d()[2];
-                AMREX_PARALLEL_FOR_3D(zbx, i, j, k, {
-                    if (k == zhi) {
-                        amrex::HostDevice::Atomic::Add(&(etarhosum_p[lev+max_lev*k]), etarhoflux_arr(i,j,k));
+
+                if (top_edge) {
+#if (AMREX_SPACEDIM == 2)
+                    for (int i = lo.x; i <= hi.x; ++i) {
+                        bin[r_hi+1-r_lo] += etarhoflux_arr(i,r_hi+1,0);
+                    }
+#else
+                    for (int j = lo.y; j <= hi.y; ++j) {
+                        for (int i = lo.x; i <= hi.x; ++i) {
+                            bin[r_hi+1-r_lo] += etarhoflux_arr(i,j,r_hi+1);
+                        }
                     }
-                });
-            }
 #endif
+                }
+            }
+
+            tile_sum.Merge(etarhosum.dataPtr(), lev, max_lev);
         }
     }
 
-    ParallelDescriptor::ReduceRealSum(etarhosum.dataPtr(),(base_geom.nr_fine+1)*(base_geom.max_radial_level+1));
+    ParallelReduceSum(etarhosum.dataPtr(),(base_geom.nr_fine+1)*(base_geom.max_radial_level+1));
 
     etarho_ec.setVal(0.0);
     etarho_cc.setVal(0.0);
@@ -178,10 +238,8 @@ Maestro::MakeEtarhoSphr (const Vector<MultiFab>& scal_old,
     const int nrf = base_geom.nr_fine + 1;
 
     Vector<MultiFab> eta_cart(finest_level+1);
-    Vector<MultiFab> rho0_nph_cart(finest_level+1);
     for (int lev=0; lev<=finest_level; ++lev) {
         eta_cart[lev].define(grids[lev], dmap[lev], 1, 1);
-        rho0_nph_cart[lev].define(grids[lev],dmap[lev],1,0);
     }
 
     BaseState<Real> rho0_nph(max_lev, base_geom.nr_fine);
@@ -196,8 +254,6 @@ Maestro::MakeEtarhoSphr (const Vector<MultiFab>& scal_old,
         });
     }
 
-    Put1dArrayOnCart(rho0_nph, rho0_nph_cart, 0, 0, bcs_f, 0);
-
 #if (AMREX_SPACEDIM == 3)
     for (int lev=0; lev<=finest_level; ++lev) {
 
@@ -212,7 +268,7 @@ Maestro::MakeEtarhoSphr (const Vector<MultiFab>& scal_old,
 
             const Array4<const Real> rho_old = scal_old[lev].array(mfi);
             const Array4<const Real> rho_new = scal_new[lev].array(mfi);
-            const Array4<const Real> rho0_nph_cart_arr = rho0_nph_cart[lev].array(mfi);
+            const auto rho0_nph_cart_arr = MakeBaseStateCart(lev, mfi, rho0_nph, 0);
             const Array4<const Real> umac_arr = umac[lev][0].array(mfi);
             const Array4<const Real> vmac = umac[lev][1].array(mfi);
             const Array4<const Real> wmac = umac[lev][2].array(mfi);
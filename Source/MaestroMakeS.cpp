@@ -22,13 +22,9 @@ Maestro::Make_S_cc (Vector<MultiFab>& S_cc,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::Make_S_cc()", Make_S_cc);
 
-    const auto max_lev = base_geom.max_radial_level + 1;
+    ThermoCacheDefine();
 
-    // put 1d base state quantities on cartestian grid for spherical case
-    Vector<MultiFab> gamma1bar_cart(finest_level+1);
-    Vector<MultiFab> p0_cart(finest_level+1);
-    Vector<MultiFab> gradp0_cart(finest_level+1);
-    Vector<MultiFab> psi_cart(finest_level+1);
+    const auto max_lev = base_geom.max_radial_level + 1;
 
     // calculate gradp0
     RealVector gradp0((base_geom.max_radial_level+1)*base_geom.nr_fine);
@@ -48,11 +44,6 @@ Maestro::Make_S_cc (Vector<MultiFab>& S_cc,
                 gradp0[r] = (p0[r+1] - p0[r-1]) / dr_loc;
             }
         }
-
-        for (int lev=0; lev<=finest_level; ++lev) {
-            gradp0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-            gradp0_cart[lev].setVal(0.);
-        }
     } else {
         if (use_delta_gamma1_term) {
             for (int lev=0; lev<=finest_level; ++lev) {
@@ -67,31 +58,6 @@ Maestro::Make_S_cc (Vector<MultiFab>& S_cc,
                 }
             }
         }
-
-        for (int lev=0; lev<=finest_level; ++lev) {
-            gradp0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-            gradp0_cart[lev].setVal(0.);
-        }
-    }
-
-    if (use_delta_gamma1_term) {
-        Put1dArrayOnCart(gradp0,gradp0_cart, 0, 0, bcs_f, 0);
-    }
-        
-    for (int lev=0; lev<=finest_level; ++lev) {
-        gamma1bar_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 1);
-        psi_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-
-        gamma1bar_cart[lev].setVal(0.);
-        p0_cart[lev].setVal(0.);
-        psi_cart[lev].setVal(0.);
-    }
-
-    if (use_delta_gamma1_term) {
-        Put1dArrayOnCart(gamma1bar, gamma1bar_cart ,0, 0, bcs_f, 0);
-        Put1dArrayOnCart(p0, p0_cart, 0, 0, bcs_f, 0);
-        Put1dArrayOnCart(psi, psi_cart, 0, 0, bcs_f, 0);
     }
 
     const auto use_omegadot_terms_in_S_loc = use_omegadot_terms_in_S;
@@ -107,6 +73,7 @@ Maestro::Make_S_cc (Vector<MultiFab>& S_cc,
 
             // Get the index space of the valid region
             const Box& tileBox = mfi.tilebox();
+            const Array4<ThermoCacheEntry> thermo_cache_arr = ThermoCacheArray(lev, mfi);
 
             const Array4<Real> S_cc_arr = S_cc[lev].array(mfi);
             const Array4<Real> delta_gamma1_term_arr = delta_gamma1_term[lev].array(mfi);
@@ -117,9 +84,9 @@ Maestro::Make_S_cc (Vector<MultiFab>& S_cc,
             const Array4<const Real> rho_Hext_arr = rho_Hext[lev].array(mfi);
             const Array4<const Real> thermal_arr = thermal[lev].array(mfi);
             const Array4<const Real> u_arr = u[lev].array(mfi);
-            const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
-            const Array4<const Real> gradp0_arr = gradp0_cart[lev].array(mfi);
-            const Array4<const Real> gamma1bar_arr = gamma1bar_cart[lev].array(mfi);
+            const auto p0_arr = MakeBaseStateCart(lev, mfi, p0, 0);
+            const auto gradp0_arr = MakeBaseStateCart(lev, mfi, gradp0, 0);
+            const auto gamma1bar_arr = MakeBaseStateCart(lev, mfi, gamma1bar, 0);
 
             if (spherical) {
 #if (AMREX_SPACEDIM == 3)
@@ -135,7 +102,7 @@ Maestro::Make_S_cc (Vector<MultiFab>& S_cc,
                     }
 
                     // dens, temp, and xmass are inputs
-                    eos(eos_input_rt, eos_state);
+                    eos_rt_cached(thermo_cache_arr, i, j, k, eos_state);
 
                     auto eos_xderivs = composition_derivatives(eos_state);
 
@@ -189,7 +156,7 @@ Maestro::Make_S_cc (Vector<MultiFab>& S_cc,
                     }
 
                     // dens, temp, and xmass are inputs
-                    eos(eos_input_rt, eos_state);
+                    eos_rt_cached(thermo_cache_arr, i, j, k, eos_state);
 
                     auto eos_xderivs = composition_derivatives(eos_state);
 
@@ -252,9 +219,9 @@ Maestro::Make_S_cc (Vector<MultiFab>& S_cc,
 
                 const Array4<Real> delta_gamma1_term_arr = delta_gamma1_term[lev].array(mfi);
                 const Array4<const Real> delta_gamma1_arr = delta_gamma1[lev].array(mfi);
-                const Array4<const Real> gamma1bar_arr = gamma1bar_cart[lev].array(mfi);
-                const Array4<const Real> psi_arr = psi_cart[lev].array(mfi);
-                const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
+                const auto gamma1bar_arr = MakeBaseStateCart(lev, mfi, gamma1bar, 0);
+                const auto psi_arr = MakeBaseStateCart(lev, mfi, psi, 0);
+                const auto p0_arr = MakeBaseStateCart(lev, mfi, p0, 0);
 
                 AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
                     delta_gamma1_term_arr(i,j,k) += delta_gamma1_arr(i,j,k) * 
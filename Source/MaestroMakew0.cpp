@@ -916,113 +916,181 @@ Maestro::Tridiag(const BaseStateArray<Real> a, const BaseStateArray<Real> b,
                  const BaseStateArray<Real> c, const BaseStateArray<Real> r, 
                  BaseStateArray<Real> u, const int n)
 {
-    BaseState<Real> gam_s(n);
-    auto gam = gam_s.array();
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::Tridiag()", Tridiag);
 
-    if (b(0) == 0) Abort("tridiag: CANT HAVE B(0) = 0.0");
+    // large systems are split into blocks of at least w0_tridiag_block_size
+    // rows.  The number of blocks depends only on n, so the answer does
+    // not depend on the number of threads
+    const int nblocks = (w0_tridiag_block_size > 0) ? 
+        n / amrex::max(w0_tridiag_block_size, 2) : 0;
 
-    Real bet = b(0);
-    u(0) = r(0) / bet;
+    if (nblocks < 2) {
 
-    for (auto j = 1; j < n; j++) {
-        gam(j) = c(j-1) / bet;
-        bet = b(j) - a(j) * gam(j);
-        if (bet == 0) Abort("tridiag: TRIDIAG FAILED");
-        u(j) = (r(j) - a(j) * u(j-1)) / bet;
-    }
+        // serial Thomas algorithm
+        if (int(tridiag_work.size()) < n) {
+            tridiag_work.resize(n);
+        }
+        Real * AMREX_RESTRICT gam = tridiag_work.dataPtr();
 
-    for (auto j = n-2; j >= 0; --j) {
-        u(j) -= gam(j+1) * u(j+1);
-    }
-}
+        if (b(0) == 0) Abort("tridiag: CANT HAVE B(0) = 0.0");
 
-void
-Maestro::ProlongBasetoUniform(const RealVector& base_ml, 
-                              RealVector& base_fine)
+        Real bet = b(0);
+        u(0) = r(0) / bet;
 
-{
-    // the mask array will keep track of whether we've filled in data
-    // in a corresponding radial bin.  .false. indicates that we've
-    // already output there.
-    IntVector imask_fine(base_geom.nr_fine);
-    std::fill(imask_fine.begin(), imask_fine.end(), 1);
+        for (auto j = 1; j < n; j++) {
+            gam[j] = c(j-1) / bet;
+            bet = b(j) - a(j) * gam[j];
+            if (bet == 0) Abort("tridiag: TRIDIAG FAILED");
+            u(j) = (r(j) - a(j) * u(j-1)) / bet;
+        }
 
-    // r1 is the factor between the current level grid spacing and the
-    // FINEST level
-    int r1 = 1;
+        for (auto j = n-2; j >= 0; --j) {
+            u(j) -= gam[j+1] * u(j+1);
+        }
 
-    const int max_lev = base_geom.max_radial_level+1;
+        return;
+    }
 
-    for (auto n = base_geom.finest_radial_level; n >= 0; --n) {
-        for (auto j = 1; j < base_geom.numdisjointchunks(n); ++j) {
-            for (auto r = base_geom.r_start_coord(n,j); r <= base_geom.r_end_coord(n,j); ++r) {
-                // sum up mask to see if there are any elements set to true 
-                if (std::accumulate(imask_fine.begin()+r*r1-1, imask_fine.begin()+(r+1)*r1-1, 0) > 0) {
-                    for (auto i = r*r1-1; i < (r+1)*r1-1; ++r) {
-                        base_fine[i] = base_ml[n+max_lev*r];
-                        imask_fine[i] = 0;
-                    }
-                }
+    // Partitioned Thomas algorithm.  The last row of every block is an
+    // interface row.  Each block eliminates its other (interior) rows
+    // independently, writing their solution as
+    //     u(j) = y(j) + lft(j) * U_{k-1} + rgt(j) * U_k,
+    // where U_k is the unknown on the interface row of block k.  The
+    // interface rows then form a tridiagonal system of nblocks unknowns,
+    // which is solved serially before the blocks fill in their interior
+    // rows.  y is stored in u.
+    if (int(tridiag_work.size()) < 3*n + 6*nblocks) {
+        tridiag_work.resize(3*n + 6*nblocks);
+    }
+    Real * AMREX_RESTRICT gam = tridiag_work.dataPtr();
+    Real * AMREX_RESTRICT lft = gam + n;
+    Real * AMREX_RESTRICT rgt = lft + n;
+    Real * AMREX_RESTRICT ra = rgt + n;
+    Real * AMREX_RESTRICT rb = ra + nblocks;
+    Real * AMREX_RESTRICT rc = rb + nblocks;
+    Real * AMREX_RESTRICT rf = rc + nblocks;
+    Real * AMREX_RESTRICT rgam = rf + nblocks;
+    Real * AMREX_RESTRICT ru = rgam + nblocks;
+
+    // every block has at least two rows, so at least one interior row
+    auto block_lo = [=] (const int k) { return int((long(k) * n) / nblocks); };
+
+    bool failed = false;
+
+    // eliminate the interior rows of every block
+#ifdef _OPENMP
+#pragma omp parallel for reduction(||:failed)
+#endif
+    for (int k = 0; k < nblocks; ++k) {
+        const int lo = block_lo(k);
+        const int hi = block_lo(k+1) - 2;
+
+        Real bet = b(lo);
+        if (bet == 0) {
+            failed = true;
+            continue;
+        }
+        u(lo) = r(lo) / bet;
+        lft[lo] = (k > 0) ? -a(lo) / bet : 0.0;
+        rgt[lo] = (lo == hi) ? -c(lo) / bet : 0.0;
+
+        for (auto j = lo+1; j <= hi; j++) {
+            gam[j] = c(j-1) / bet;
+            bet = b(j) - a(j) * gam[j];
+            if (bet == 0) {
+                failed = true;
+                break;
             }
+            u(j) = (r(j) - a(j) * u(j-1)) / bet;
+            lft[j] = -a(j) * lft[j-1] / bet;
+            rgt[j] = ((j == hi) ? -c(j) : 0.0) - a(j) * rgt[j-1];
+            rgt[j] /= bet;
+        }
+
+        for (auto j = hi-1; j >= lo; --j) {
+            u(j) -= gam[j+1] * u(j+1);
+            lft[j] -= gam[j+1] * lft[j+1];
+            rgt[j] -= gam[j+1] * rgt[j+1];
         }
-        // update r1 for the next coarsest level -- assume a jump by
-        // factor of 2
-        r1 *= 2;
-    }
-    
-    // check to make sure that no mask values are still true
-    if (std::accumulate(imask_fine.begin(), imask_fine.end(), 0) > 0) {
-        Abort("ERROR: unfilled cells in prolong_base_to_uniform");
     }
-}
 
+    if (failed) Abort("tridiag: TRIDIAG FAILED");
 
-void
-Maestro::ProlongBasetoUniform(const RealVector& base_ml, 
-                              BaseState<Real>& base_fine_s)
+    // the system for the interface rows
+    for (int k = 0; k < nblocks; ++k) {
+        const int j = block_lo(k+1) - 1;
 
-{
-    // the mask array will keep track of whether we've filled in data
-    // in a corresponding radial bin.  .false. indicates that we've
-    // already output there.
-    IntVector imask_fine(base_geom.nr_fine);
-    std::fill(imask_fine.begin(), imask_fine.end(), 1);
+        ra[k] = a(j) * lft[j-1];
+        rb[k] = b(j) + a(j) * rgt[j-1];
+        rc[k] = 0.0;
+        rf[k] = r(j) - a(j) * u(j-1);
 
-    auto base_fine = base_fine_s.array();
+        if (k < nblocks-1) {
+            rb[k] += c(j) * lft[j+1];
+            rc[k] = c(j) * rgt[j+1];
+            rf[k] -= c(j) * u(j+1);
+        }
+    }
 
-    // r1 is the factor between the current level grid spacing and the
-    // FINEST level
-    int r1 = 1;
+    if (rb[0] == 0) Abort("tridiag: TRIDIAG FAILED");
 
-    const int max_lev = base_geom.max_radial_level+1;
+    Real bet = rb[0];
+    ru[0] = rf[0] / bet;
 
-    for (auto n = base_geom.finest_radial_level; n >= 0; --n) {
-        for (auto j = 1; j < base_geom.numdisjointchunks(n); ++j) {
-            for (auto r = base_geom.r_start_coord(n,j); r <= base_geom.r_end_coord(n,j); ++r) {
-                // sum up mask to see if there are any elements set to true 
-                if (std::accumulate(imask_fine.begin()+r*r1-1, imask_fine.begin()+(r+1)*r1-1, 0) > 0) {
-                    for (auto i = r*r1-1; i < (r+1)*r1-1; ++r) {
-                        base_fine(i) = base_ml[n+max_lev*r];
-                        imask_fine[i] = 0;
-                    }
-                }
-            }
-        }
-        // update r1 for the next coarsest level -- assume a jump by
-        // factor of 2
-        r1 *= 2;
+    for (auto k = 1; k < nblocks; k++) {
+        rgam[k] = rc[k-1] / bet;
+        bet = rb[k] - ra[k] * rgam[k];
+        if (bet == 0) Abort("tridiag: TRIDIAG FAILED");
+        ru[k] = (rf[k] - ra[k] * ru[k-1]) / bet;
     }
-    
-    // check to make sure that no mask values are still true
-    if (std::accumulate(imask_fine.begin(), imask_fine.end(), 0) > 0) {
-        Abort("ERROR: unfilled cells in prolong_base_to_uniform");
+
+    for (auto k = nblocks-2; k >= 0; --k) {
+        ru[k] -= rgam[k+1] * ru[k+1];
+    }
+
+    // fill in every block from its interface values
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (int k = 0; k < nblocks; ++k) {
+        const int lo = block_lo(k);
+        const int hi = block_lo(k+1) - 2;
+        const Real u_lo = (k > 0) ? ru[k-1] : 0.0;
+
+        for (auto j = lo; j <= hi; ++j) {
+            u(j) += lft[j] * u_lo + rgt[j] * ru[k];
+        }
+        u(hi+1) = ru[k];
     }
 }
 
 void
-Maestro::ProlongBasetoUniform(const BaseState<Real>& base_ml_s, 
-                              BaseState<Real>& base_fine_s)
+Maestro::ProlongBasetoUniform(const RealVector& base_ml, 
+                              RealVector& base_fine)
+{
+    ProlongBasetoUniform(makeRadialBaseStateArray(base_ml, base_geom.max_radial_level+1, base_geom.nr_fine),
+                         makeRadialBaseStateArray(base_fine, 1, base_fine.size()));
+}
+
+void
+Maestro::ProlongBasetoUniform(const RealVector& base_ml, 
+                              BaseState<Real>& base_fine)
+{
+    ProlongBasetoUniform(makeRadialBaseStateArray(base_ml, base_geom.max_radial_level+1, base_geom.nr_fine),
+                         base_fine.array());
+}
+
+void
+Maestro::ProlongBasetoUniform(const BaseState<Real>& base_ml, 
+                              BaseState<Real>& base_fine)
+{
+    ProlongBasetoUniform(base_ml.const_array(), base_fine.array());
+}
 
+void
+Maestro::ProlongBasetoUniform(const BaseStateArray<const Real>& base_ml, 
+                              BaseStateArray<Real> base_fine)
 {
     // the mask array will keep track of whether we've filled in data
     // in a corresponding radial bin.  .false. indicates that we've
@@ -1034,10 +1102,6 @@ Maestro::ProlongBasetoUniform(const BaseState<Real>& base_ml_s,
     // FINEST level
     int r1 = 1;
 
-    const int max_lev = base_geom.max_radial_level+1;
-    const auto base_ml = base_ml_s.const_array();
-    auto base_fine = base_fine_s.array();
-
     for (auto n = base_geom.finest_radial_level; n >= 0; --n) {
         for (auto j = 1; j < base_geom.numdisjointchunks(n); ++j) {
             for (auto r = base_geom.r_start_coord(n,j); r <= base_geom.r_end_coord(n,j); ++r) {
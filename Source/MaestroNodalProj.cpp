@@ -152,37 +152,8 @@ Maestro::NodalProj (int proj_type,
  */
     SetBoundaryVelocity(Vproj);
 
-    std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_lobc;
-    std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_hibc;
-    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
-    {
-        if (Geom(0).isPeriodic(idim)) {
-            mlmg_lobc[idim] = mlmg_hibc[idim] = LinOpBCType::Periodic;
-        } else {
-            if (phys_bc[idim] == Outflow) {
-                mlmg_lobc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_lobc[idim] = LinOpBCType::Neumann;
-            }
-
-            if (phys_bc[AMREX_SPACEDIM+idim] == Outflow) {
-                mlmg_hibc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_hibc[idim] = LinOpBCType::Neumann;
-            }
-        }
-    }
-
-    LPInfo info;
-    info.setAgglomeration(true);
-    info.setConsolidation(true);
-    info.setMetricTerm(false);
-
-    MLNodeLaplacian mlndlap(geom, grids, dmap, info);
-    mlndlap.setGaussSeidel(true);
-    mlndlap.setHarmonicAverage(false);
-
-    mlndlap.setDomainBC(mlmg_lobc, mlmg_hibc);
+    // the persistent MLNodeLaplacian already holds the domain bc's
+    MLNodeLaplacian& mlndlap = NodalLinOp();
 
     // set sig in the MLNodeLaplacian object
     for (int ilev = 0; ilev <= finest_level; ++ilev) {
@@ -205,6 +176,45 @@ Maestro::NodalProj (int proj_type,
         phi[lev].setVal(0.);
     }
 
+    // for the regular time step phi = dt*pi^{n+1/2}, so we can start the
+    // solve from pi of the previous time step (nodal_proj_warm_start = 1),
+    // or from its linear extrapolation in time using the last two time
+    // steps (nodal_proj_warm_start = 2), instead of from zero.  We fall
+    // back to fewer time levels if the history is not available yet, or
+    // was discarded by a regrid
+    int nseed = 0;
+    if (proj_type == regular_timestep_comp && nodal_proj_warm_start > 0) {
+        nseed = std::min(nodal_proj_warm_start, 2);
+        for (int n = 0; n < nseed; ++n) {
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                if (!pi_hist[n][lev].ok() ||
+                    pi_hist[n][lev].boxArray() != phi[lev].boxArray() ||
+                    pi_hist[n][lev].DistributionMap() != phi[lev].DistributionMap()) {
+                    nseed = std::min(nseed, n);
+                }
+            }
+        }
+        if (nseed == 2 && pi_hist_time[0] <= pi_hist_time[1]) {
+            nseed = 1;
+        }
+
+        if (nseed == 1) {
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                MultiFab::Copy(phi[lev], pi_hist[0][lev], 0, 0, 1, 0);
+                phi[lev].mult(dt, 0, 1, 0);
+            }
+        } else if (nseed == 2) {
+            const Real fac = (0.5*(t_old+t_new) - pi_hist_time[0]) /
+                (pi_hist_time[0] - pi_hist_time[1]);
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                MultiFab::LinComb(phi[lev],
+                                  dt*(1.+fac), pi_hist[0][lev], 0,
+                                  -dt*fac,     pi_hist[1][lev], 0,
+                                  0, 1, 0);
+            }
+        }
+    }
+
     // multiply rhcc = beta0*(S-Sbar) by -1 since we want
     // rhstotal to contain div(beta*Vproj) - beta0*(S-Sbar)
     for (int lev=0; lev<=finest_level; ++lev) {
@@ -243,6 +253,7 @@ Maestro::NodalProj (int proj_type,
     MLMG mlmg(mlndlap);
     mlmg.setVerbose(mg_verbose);
     mlmg.setCGVerbose(cg_verbose);
+    SetMLMGOptions(mlmg, nodal_tuner.Config());
 
     Real abs_tol = -1.;     // disable absolute tolerance
     Real rel_tol = 1.e-3;
@@ -288,6 +299,7 @@ Maestro::NodalProj (int proj_type,
         if (launched) Gpu::setLaunchRegion(false);
     }
 #endif
+    const Real solve_start = ParallelDescriptor::second();
     mlmg.solve(amrex::GetVecOfPtrs(phi),
                amrex::GetVecOfConstPtrs(rhstotal),
                                rel_tol, abs_tol);
@@ -297,8 +309,14 @@ Maestro::NodalProj (int proj_type,
         if (launched) Gpu::setLaunchRegion(true);
     }
 #endif
+    // only the regular time step solves are comparable enough to tune on
+    if (proj_type == regular_timestep_comp) {
+        SolverTuneRecord(nodal_tuner, solve_start, "nodal");
+    }
     Print() << "Done calling nodal solver" << std::endl;
 
+    const int nodal_iters = mlmg.getNumIters();
+
     // convert beta0*Vproj back to Vproj
     for (int lev=0; lev<=finest_level; ++lev) {
         for (int dir=0; dir<AMREX_SPACEDIM; ++dir) {
@@ -364,6 +382,38 @@ Maestro::NodalProj (int proj_type,
             pi[lev].mult(1./dt);
             gpi[lev].mult(1./dt);
         }
+
+        if (nodal_proj_warm_start > 0) {
+            // keep pi^{n+1/2} to seed the next time step
+            std::swap(pi_hist[0], pi_hist[1]);
+            pi_hist_time[1] = pi_hist_time[0];
+            for (int lev=0; lev<=finest_level; ++lev) {
+                if (pi_hist[0][lev].boxArray() != pi[lev].boxArray() ||
+                    pi_hist[0][lev].DistributionMap() != pi[lev].DistributionMap()) {
+                    pi_hist[0][lev].define(pi[lev].boxArray(), pi[lev].DistributionMap(), 1, 0);
+                }
+                MultiFab::Copy(pi_hist[0][lev],pi[lev],0,0,1,0);
+            }
+            pi_hist_time[0] = 0.5*(t_old+t_new);
+
+            // a solve started from zero sets the reference that the
+            // seeded solves are measured against
+            if (nseed == 0) {
+                nodal_cold_iters = nodal_iters;
+            } else if (nodal_cold_iters >= 0) {
+                nodal_iters_saved += nodal_cold_iters - nodal_iters;
+            }
+
+            if (maestro_verbose > 0) {
+                Print() << "Nodal solve seeded from " << nseed << " previous pi took "
+                        << nodal_iters << " iterations";
+                if (nodal_cold_iters >= 0) {
+                    Print() << " (unseeded: " << nodal_cold_iters
+                            << ", total saved: " << nodal_iters_saved << ")";
+                }
+                Print() << std::endl;
+            }
+        }
     }
 
     // update velocity
@@ -2,7 +2,12 @@
 #include <Maestro_F.H>
 #include <MaestroPlot.H>
 #include <AMReX_buildInfo.H>
+#include <MaestroBaseStateIO.H>
+#include <AMReX_AsyncOut.H>
+#include <AMReX_NFiles.H>
+#include <algorithm>
 #include <iterator>     // std::istream_iterator
+#include <numeric>
 
 using namespace amrex;
 
@@ -76,76 +81,144 @@ Maestro::WritePlotFile (const int step,
         PlotFileName(step, &plotfilename);
     }
 
-    // convert rho0 to multi-D MultiFab
-    Vector<MultiFab> rho0_cart(finest_level+1);
-    for (int lev=0; lev<=finest_level; ++lev) {
-        rho0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-    }
-    Put1dArrayOnCart(rho0_in,rho0_cart,0,0);
-
-    // convert rhoh0 to multi-D MultiFab
-    Vector<MultiFab> rhoh0_cart(finest_level+1);
-    for (int lev=0; lev<=finest_level; ++lev) {
-        rhoh0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-    }
-    Put1dArrayOnCart(rhoh0_in,rhoh0_cart,0,0);
-
-    // convert p0 to multi-D MultiFab
-    Vector<MultiFab> p0_cart(finest_level+1);
-    for (int lev=0; lev<=finest_level; ++lev) {
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-    }
-    Put1dArrayOnCart(p0_in,p0_cart,0,0);
-
-    // convert gamma1bar to multi-D MultiFab
-    Vector<MultiFab> gamma1bar_cart(finest_level+1);
-    for (int lev=0; lev<=finest_level; ++lev) {
-        gamma1bar_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-    }
-    Put1dArrayOnCart(gamma1bar_in,gamma1bar_cart,0,0);
+    // convert rho0, rhoh0, p0 and gamma1bar to multi-D MultiFabs
+    Vector<MultiFab> rho0_cart;
+    Vector<MultiFab> rhoh0_cart;
+    Vector<MultiFab> p0_cart;
+    Vector<MultiFab> gamma1bar_cart;
+    PlotFileBaseStateCart(rho0_in,rhoh0_in,p0_in,gamma1bar_in,
+                          rho0_cart,rhoh0_cart,p0_cart,gamma1bar_cart);
 
     int nPlot = 0;
     const auto& varnames = PlotFileVarNames(&nPlot);
 
-    const auto& mf = PlotFileMF(nPlot,t_in,dt_in,rho0_cart,rhoh0_cart,p0_cart,
-                                gamma1bar_cart,u_in,s_in,p0_in,gamma1bar_in,
-                                S_cc_in);
+    // only the selected variables are computed and written
+    const auto& plot_varnames = is_small ?
+        SelectPlotFileVarNames("small_plot_vars", small_plot_vars, varnames) :
+        SelectPlotFileVarNames("plot_vars", plot_vars, varnames);
+
+    // the chunked writer needs a binary fab.format, where every value
+    // takes the same number of bytes
+    const bool chunked = plot_chunk_size > 0 &&
+        plot_chunk_size < static_cast<int>(plot_varnames.size()) &&
+        FArrayBox::getFormat() != FABio::FAB_ASCII &&
+        FArrayBox::getFormat() != FABio::FAB_8BIT;
+
+    // only one plotfile is written in the background at a time
+    FinishPlotFile();
+
+    // with plot_async, the plot data is computed here and then written by
+    // the AsyncOut thread while the time step loop continues.  As with
+    // checkpoints, the plotfile goes to a temporary directory that
+    // FinishPlotFile renames once every rank is done.  The chunked writer
+    // exists to hold less data in memory, so it always writes in place
+    const bool async = plot_async && !chunked && AsyncOut::UseAsyncOut();
+    if (plot_async && !async) {
+        Print() << "plot_async requires amrex.async_out = 1 and plot_chunk_size = 0, "
+                << "writing synchronously\n";
+    }
+    const std::string dirname = async ? plotfilename + ".temp" : plotfilename;
 
     // WriteMultiLevelPlotfile expects an array of step numbers
     Vector<int> step_array;
     step_array.resize(maxLevel()+1, step);
 
-    if (!is_small) {
-        WriteMultiLevelPlotfile(plotfilename, finest_level+1, mf, varnames,
-                                Geom(), t_in, step_array, refRatio());
+    if (chunked) {
+        WritePlotFileChunked(plotfilename,step,t_in,dt_in,varnames,plot_varnames,
+                             rho0_cart,rhoh0_cart,p0_cart,gamma1bar_cart,u_in,
+                             s_in,p0_in,gamma1bar_in,S_cc_in);
     } else {
-        int nSmallPlot = 0;
-        const auto& small_plot_varnames = SmallPlotFileVarNames(&nSmallPlot,
-                                                                varnames);
+        const auto& mf = PlotFileMF(varnames,plot_varnames,t_in,dt_in,rho0_cart,
+                                    rhoh0_cart,p0_cart,gamma1bar_cart,u_in,s_in,
+                                    p0_in,gamma1bar_in,S_cc_in);
+
+        if (async) {
+            // the layout of WriteMultiLevelPlotfile
+            PreBuildDirectorHierarchy(dirname, "Level_", finest_level+1, true);
+
+            if (ParallelDescriptor::IOProcessor()) {
+                Vector<BoxArray> boxArrays(finest_level+1);
+                for (int lev = 0; lev <= finest_level; ++lev) {
+                    boxArrays[lev] = grids[lev];
+                }
 
-        const auto& small_mf = SmallPlotFileMF(nPlot, nSmallPlot, mf, varnames,
-                                               small_plot_varnames);
+                std::ostringstream HeaderFile;
+                HeaderFile.precision(17);
+                WriteGenericPlotfileHeader(HeaderFile, finest_level+1, boxArrays,
+                                           plot_varnames, Geom(), t_in, step_array,
+                                           refRatio(), "HyperCLaw-V1.1", "Level_",
+                                           "Cell");
+
+                const std::string name = dirname + "/Header";
+                AsyncOut::Submit([name, contents = HeaderFile.str()] () {
+                    WriteFileContents(name, contents);
+                });
+            }
 
-        WriteMultiLevelPlotfile(plotfilename, finest_level+1, small_mf,
-                                small_plot_varnames, Geom(), t_in, step_array,
-                                refRatio());
+            // VisMF::AsyncWrite copies the data before returning, so the
+            // plot data can be freed right away
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                VisMF::AsyncWrite(*mf[lev], MultiFabFileFullPrefix(lev, dirname,
+                                                                   "Level_", "Cell"));
+            }
+        } else {
+            WriteMultiLevelPlotfile(plotfilename, finest_level+1, mf, plot_varnames,
+                                    Geom(), t_in, step_array, refRatio());
+        }
 
-        for (int i = 0; i <= finest_level; ++i)
-            delete small_mf[i];
+        for (int i = 0; i <= finest_level; ++i) {
+            delete mf[i];
+        }
     }
 
-    WriteJobInfo(plotfilename);
+    WriteJobInfo(dirname);
 
     VisMF::IO_Buffer io_buffer(VisMF::IO_Buffer_Size);
 
+    // write out the base state, in binary if plot_base_binary is set
+    if (ParallelDescriptor::IOProcessor() && plot_base_binary) {
+
+        const int max_lev = base_geom.max_radial_level+1;
+
+        for (int lev=0; lev<=base_geom.max_radial_level; ++lev) {
+
+            // the radius-major base state is gathered into one column per
+            // field: r_cc, rho0, rhoh0, p0, gamma1bar
+            const int nr_lev = base_geom.nr(lev);
+            Vector<Real> cc(5*nr_lev);
+            for (int i=0; i<nr_lev; ++i) {
+                cc[i]          = base_geom.r_cc_loc(lev,i);
+                cc[i+nr_lev]   = rho0_in[lev+max_lev*i];
+                cc[i+2*nr_lev] = rhoh0_in[lev+max_lev*i];
+                cc[i+3*nr_lev] = p0_in[lev+max_lev*i];
+                cc[i+4*nr_lev] = gamma1bar_in[lev+max_lev*i];
+            }
+            const Vector<const Real*> cc_cols = {&cc[0], &cc[nr_lev], &cc[2*nr_lev],
+                                                 &cc[3*nr_lev], &cc[4*nr_lev]};
+
+            // r_edge, w0
+            Vector<Real> fc(2*(nr_lev+1));
+            for (int i=0; i<=nr_lev; ++i) {
+                fc[i]          = base_geom.r_edge_loc(lev,i);
+                fc[i+nr_lev+1] = w0[lev+max_lev*i];
+            }
+            const Vector<const Real*> fc_cols = {&fc[0], &fc[nr_lev+1]};
+
+            WriteFileContents(dirname + "/BaseCC_" + std::to_string(lev),
+                          BaseStateBinary::Pack(cc_cols, nr_lev));
+            WriteFileContents(dirname + "/BaseFC_" + std::to_string(lev),
+                          BaseStateBinary::Pack(fc_cols, nr_lev+1));
+        }
+    }
+
     // write out the cell-centered base state
-    if (ParallelDescriptor::IOProcessor()) {
+    if (ParallelDescriptor::IOProcessor() && !plot_base_binary) {
 
         for (int lev=0; lev<=base_geom.max_radial_level; ++lev) {
 
             std::ofstream BaseCCFile;
             BaseCCFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
-            std::string BaseCCFileName(plotfilename + "/BaseCC_");
+            std::string BaseCCFileName(dirname + "/BaseCC_");
             std::string levStr = std::to_string(lev);
             BaseCCFileName.append(levStr);
             BaseCCFile.open(BaseCCFileName.c_str(), std::ofstream::out   |
@@ -170,13 +243,13 @@ Maestro::WritePlotFile (const int step,
     }
 
     // write out the face-centered base state
-    if (ParallelDescriptor::IOProcessor()) {
+    if (ParallelDescriptor::IOProcessor() && !plot_base_binary) {
 
         for (int lev = 0; lev <= base_geom.max_radial_level; ++lev) {
 
             std::ofstream BaseFCFile;
             BaseFCFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
-            std::string BaseFCFileName(plotfilename + "/BaseFC_");
+            std::string BaseFCFileName(dirname + "/BaseFC_");
             std::string levStr = std::to_string(lev);
             BaseFCFileName.append(levStr);
             BaseFCFile.open(BaseFCFileName.c_str(), std::ofstream::out   |
@@ -206,13 +279,33 @@ Maestro::WritePlotFile (const int step,
         Print() << "Time to write plotfile: " << end_total << '\n';
     }
 
-    for (int i = 0; i <= finest_level; ++i) {
-        delete mf[i];
+    if (async) {
+        plot_pending = plotfilename;
     }
-
 }
 
 
+// wait for the plotfile being written in the background, if any, and
+// move it to its final name
+void
+Maestro::FinishPlotFile ()
+{
+    if (plot_pending.empty()) {
+        return;
+    }
+
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::FinishPlotFile()",FinishPlotFile);
+
+    FinishAsyncDirectory(plot_pending);
+
+    if (maestro_verbose > 0) {
+        Print() << "Finished plotfile " << plot_pending << "\n";
+    }
+
+    plot_pending.clear();
+}
+
 // get plotfile name
 void
 Maestro::PlotFileName (const int lev, std::string* plotfilename)
@@ -220,7 +313,303 @@ Maestro::PlotFileName (const int lev, std::string* plotfilename)
     *plotfilename = Concatenate(*plotfilename, lev, 7);
 }
 
-// put together a vector of multifabs for writing
+// put rho0, rhoh0, p0 and gamma1bar on the cartesian grid, as PlotFileMF
+// needs them
+void
+Maestro::PlotFileBaseStateCart (const RealVector& rho0_in,
+                                const RealVector& rhoh0_in,
+                                const RealVector& p0_in,
+                                const RealVector& gamma1bar_in,
+                                Vector<MultiFab>& rho0_cart,
+                                Vector<MultiFab>& rhoh0_cart,
+                                Vector<MultiFab>& p0_cart,
+                                Vector<MultiFab>& gamma1bar_cart)
+{
+    rho0_cart.resize(finest_level+1);
+    rhoh0_cart.resize(finest_level+1);
+    p0_cart.resize(finest_level+1);
+    gamma1bar_cart.resize(finest_level+1);
+
+    for (int lev=0; lev<=finest_level; ++lev) {
+        rho0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
+        rhoh0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
+        p0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
+        gamma1bar_cart[lev].define(grids[lev], dmap[lev], 1, 0);
+    }
+
+    Put1dArrayOnCart(rho0_in,rho0_cart,0,0);
+    Put1dArrayOnCart(rhoh0_in,rhoh0_cart,0,0);
+    Put1dArrayOnCart(p0_in,p0_cart,0,0);
+    Put1dArrayOnCart(gamma1bar_in,gamma1bar_cart,0,0);
+}
+
+// compute and write the variables plot_varnames of the plotfile
+// plotfilename plot_chunk_size variables at a time.  The plotfile has the
+// same layout on disk as one written by WriteMultiLevelPlotfile: the fabs
+// of each level, with all their components, go to at most
+// VisMF::GetNOutFiles() Cell_D files, each shared by the ranks that
+// NFilesIter assigns to it, and each chunk of components is written into
+// place in those files.  The ranks sharing a file write one after another,
+// so no more than that many ranks write at a time
+void
+Maestro::WritePlotFileChunked (const std::string& plotfilename,
+                               const int step,
+                               const Real t_in,
+                               const Real dt_in,
+                               const Vector<std::string>& varnames,
+                               const Vector<std::string>& plot_varnames,
+                               const Vector<MultiFab>& rho0_cart,
+                               const Vector<MultiFab>& rhoh0_cart,
+                               const Vector<MultiFab>& p0_cart,
+                               const Vector<MultiFab>& gamma1bar_cart,
+                               const Vector<MultiFab>& u_in,
+                               Vector<MultiFab>& s_in,
+                               const RealVector& p0_in,
+                               const RealVector& gamma1bar_in,
+                               const Vector<MultiFab>& S_cc_in)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::WritePlotFileChunked()",WritePlotFileChunked);
+
+    const int nlevs = finest_level+1;
+    const int nOut = plot_varnames.size();
+    const int myproc = ParallelDescriptor::MyProc();
+    const int nprocs = ParallelDescriptor::NProcs();
+    const int ioproc = ParallelDescriptor::IOProcessorNumber();
+
+    // the data file of every rank, as VisMF::Write picks it
+    const int nOutFiles = std::max(1, std::min(VisMF::GetNOutFiles(), nprocs));
+    const bool groupSets = VisMF::GetGroupSets();
+    Vector<int> file_number(nprocs);
+    for (int proc = 0; proc < nprocs; ++proc) {
+        file_number[proc] = NFilesIter::FileNumber(nOutFiles, proc, groupSets);
+    }
+
+    // the ranks sharing a file write it in rank order: this rank waits for
+    // prev_proc and then hands the file on to next_proc
+    int prev_proc = -1;
+    int next_proc = -1;
+    for (int proc = myproc-1; proc >= 0 && prev_proc < 0; --proc) {
+        if (file_number[proc] == file_number[myproc]) prev_proc = proc;
+    }
+    for (int proc = myproc+1; proc < nprocs && next_proc < 0; ++proc) {
+        if (file_number[proc] == file_number[myproc]) next_proc = proc;
+    }
+
+    PreBuildDirectorHierarchy(plotfilename, "Level_", nlevs, true);
+
+    // the plotfile header
+    if (ParallelDescriptor::IOProcessor()) {
+        VisMF::IO_Buffer io_buffer(VisMF::IO_Buffer_Size);
+
+        std::ofstream HeaderFile;
+        HeaderFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
+        std::string HeaderFileName(plotfilename + "/Header");
+        HeaderFile.open(HeaderFileName.c_str(), std::ofstream::out   |
+                        std::ofstream::trunc |
+                        std::ofstream::binary);
+        if(!HeaderFile.good()) {
+            amrex::FileOpenFailed(HeaderFileName);
+        }
+        HeaderFile.precision(17);
+
+        Vector<BoxArray> boxArrays(nlevs);
+        for (int lev = 0; lev < nlevs; ++lev) {
+            boxArrays[lev] = grids[lev];
+        }
+
+        Vector<int> step_array(nlevs, step);
+
+        WriteGenericPlotfileHeader(HeaderFile, nlevs, boxArrays, plot_varnames,
+                                   Geom(), t_in, step_array, refRatio(),
+                                   "HyperCLaw-V1.1", "Level_", "Cell");
+    }
+
+    // number of bytes a Real takes in the data files, which depends on
+    // the output format (fab.format)
+    const FABio& fabio = FArrayBox::getFABio();
+    Long real_bytes;
+    {
+        FArrayBox onefab(Box(IntVect::TheZeroVector(), IntVect::TheZeroVector()), 1);
+        onefab.setVal<RunOn::Host>(0.);
+        std::ostringstream os;
+        fabio.write(os, onefab, 0, 1);
+        real_bytes = os.str().size();
+    }
+
+    // offset of the data of each fab in its Cell_D file, which every rank
+    // works out the same way: the fabs of a file are laid out in the
+    // order of their ranks, and of their indices within a rank.  The min
+    // and max of every component of each fab are only filled in by its
+    // own rank and are gathered onto the IO processor
+    Vector<Vector<Long> > fab_offset(nlevs);
+    Vector<Vector<Long> > data_offset(nlevs);
+    Vector<Vector<Real> > fab_min(nlevs);
+    Vector<Vector<Real> > fab_max(nlevs);
+
+    for (int lev = 0; lev < nlevs; ++lev) {
+        const int nfabs = grids[lev].size();
+
+        fab_offset[lev].resize(nfabs, 0);
+        data_offset[lev].resize(nfabs, 0);
+        fab_min[lev].resize(nfabs*nOut, 0.);
+        fab_max[lev].resize(nfabs*nOut, 0.);
+
+        Vector<int> order(nfabs);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&] (const int a, const int b) {
+            return dmap[lev][a] < dmap[lev][b];
+        });
+
+        Vector<Long> file_end(nOutFiles, 0);
+        for (const int k : order) {
+            Long& offset = file_end[file_number[dmap[lev][k]]];
+
+            // the fab header, written with the first chunk
+            std::ostringstream os;
+            fabio.write_header(os, FArrayBox(grids[lev][k], 1, false), nOut);
+
+            fab_offset[lev][k] = offset;
+            data_offset[lev][k] = offset + os.str().size();
+            offset = data_offset[lev][k] + grids[lev][k].numPts()*nOut*real_bytes;
+        }
+    }
+
+    const std::string datafile = Concatenate("Cell_D_", file_number[myproc], 5);
+
+    for (int first = 0; first < nOut; first += plot_chunk_size) {
+
+        const int nchunk = std::min(plot_chunk_size, nOut-first);
+
+        Vector<std::string> chunk_varnames(plot_varnames.begin()+first,
+                                           plot_varnames.begin()+first+nchunk);
+
+        const auto& mf = PlotFileMF(varnames,chunk_varnames,t_in,dt_in,rho0_cart,
+                                    rhoh0_cart,p0_cart,gamma1bar_cart,u_in,s_in,
+                                    p0_in,gamma1bar_in,S_cc_in);
+
+        Gpu::synchronize();
+
+        for (int lev = 0; lev < nlevs; ++lev) {
+
+            // wait for the previous rank of this file to be done with it
+            const int tag = ParallelDescriptor::SeqNum();
+            int token = 0;
+            if (prev_proc >= 0) {
+                ParallelDescriptor::Recv(&token, 1, prev_proc, tag);
+            }
+
+            if (mf[lev]->local_size() > 0) {
+
+                VisMF::IO_Buffer io_buffer(VisMF::IO_Buffer_Size);
+
+                // the rank whose fabs start the file creates it with the
+                // first chunk
+                bool creates_file = false;
+                for (MFIter mfi(*mf[lev]); mfi.isValid(); ++mfi) {
+                    creates_file = creates_file || fab_offset[lev][mfi.index()] == 0;
+                }
+
+                std::string FileName(plotfilename + "/Level_" + std::to_string(lev)
+                                     + "/" + datafile);
+                std::fstream DataFile;
+                DataFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
+                if (first == 0 && creates_file) {
+                    DataFile.open(FileName.c_str(), std::ios::out   |
+                                  std::ios::trunc |
+                                  std::ios::binary);
+                } else {
+                    DataFile.open(FileName.c_str(), std::ios::in  |
+                                  std::ios::out |
+                                  std::ios::binary);
+                }
+                if(!DataFile.good()) {
+                    amrex::FileOpenFailed(FileName);
+                }
+
+                for (MFIter mfi(*mf[lev]); mfi.isValid(); ++mfi) {
+                    const FArrayBox& fab = (*mf[lev])[mfi];
+                    const int k = mfi.index();
+
+                    if (first == 0) {
+                        DataFile.seekp(fab_offset[lev][k]);
+                        fabio.write_header(DataFile, fab, nOut);
+                    }
+
+                    DataFile.seekp(data_offset[lev][k] + fab.box().numPts()*first*real_bytes);
+                    fabio.write(DataFile, fab, 0, nchunk);
+
+                    for (int n = 0; n < nchunk; ++n) {
+                        fab_min[lev][k*nOut+first+n] = fab.min<RunOn::Host>(n);
+                        fab_max[lev][k*nOut+first+n] = fab.max<RunOn::Host>(n);
+                    }
+                }
+
+                DataFile.flush();
+                if(!DataFile.good()) {
+                    amrex::Abort("WritePlotFileChunked: error writing " + FileName);
+                }
+            }
+
+            if (next_proc >= 0) {
+                ParallelDescriptor::Send(&token, 1, next_proc, tag);
+            }
+        }
+
+        for (int lev = 0; lev < nlevs; ++lev) {
+            delete mf[lev];
+        }
+    }
+
+    // the MultiFab header of each level
+    for (int lev = 0; lev < nlevs; ++lev) {
+        const int nfabs = grids[lev].size();
+
+        ParallelDescriptor::ReduceRealSum(fab_min[lev].dataPtr(), nfabs*nOut, ioproc);
+        ParallelDescriptor::ReduceRealSum(fab_max[lev].dataPtr(), nfabs*nOut, ioproc);
+
+        if (ParallelDescriptor::IOProcessor()) {
+            VisMF::Header hdr;
+            hdr.m_vers = VisMF::Header::Version_v1;
+            hdr.m_how = VisMF::NFiles;
+            hdr.m_ncomp = nOut;
+            hdr.m_ba = grids[lev];
+            hdr.m_fod.resize(nfabs);
+            hdr.m_min.resize(nfabs);
+            hdr.m_max.resize(nfabs);
+
+            for (int k = 0; k < nfabs; ++k) {
+                hdr.m_fod[k] = VisMF::FabOnDisk(Concatenate("Cell_D_",
+                                                            file_number[dmap[lev][k]], 5),
+                                                fab_offset[lev][k]);
+                hdr.m_min[k].assign(fab_min[lev].begin()+k*nOut,
+                                    fab_min[lev].begin()+(k+1)*nOut);
+                hdr.m_max[k].assign(fab_max[lev].begin()+k*nOut,
+                                    fab_max[lev].begin()+(k+1)*nOut);
+            }
+
+            VisMF::IO_Buffer io_buffer(VisMF::IO_Buffer_Size);
+
+            std::ofstream MFHeaderFile;
+            MFHeaderFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
+            std::string MFHeaderFileName(MultiFabFileFullPrefix(lev, plotfilename,
+                                                                "Level_", "Cell")
+                                         + "_H");
+            MFHeaderFile.open(MFHeaderFileName.c_str(), std::ofstream::out   |
+                              std::ofstream::trunc |
+                              std::ofstream::binary);
+            if(!MFHeaderFile.good()) {
+                amrex::FileOpenFailed(MFHeaderFileName);
+            }
+
+            MFHeaderFile << hdr;
+        }
+    }
+
+    ParallelDescriptor::Barrier();
+}
+
+// put together a vector of multifabs for writing, with every plot variable
 Vector<const MultiFab*>
 Maestro::PlotFileMF (const int nPlot,
                      const Real t_in,
@@ -234,16 +623,78 @@ Maestro::PlotFileMF (const int nPlot,
                      const RealVector& p0_in,
                      const RealVector& gamma1bar_in,
                      const Vector<MultiFab>& S_cc_in)
+{
+    int n = nPlot;
+    const auto& varnames = PlotFileVarNames(&n);
+
+    return PlotFileMF(varnames, varnames, t_in, dt_in, rho0_cart, rhoh0_cart,
+                      p0_cart, gamma1bar_cart, u_in, s_in, p0_in, gamma1bar_in,
+                      S_cc_in);
+}
+
+// put together a vector of multifabs for writing, with the variables
+// plot_varnames taken from the full list varnames.  Only the selected
+// variables, and whatever they are derived from, are computed
+Vector<const MultiFab*>
+Maestro::PlotFileMF (const Vector<std::string>& varnames,
+                     const Vector<std::string>& plot_varnames,
+                     const Real t_in,
+                     const Real dt_in,
+                     const Vector<MultiFab>& rho0_cart,
+                     const Vector<MultiFab>& rhoh0_cart,
+                     const Vector<MultiFab>& p0_cart,
+                     const Vector<MultiFab>& gamma1bar_cart,
+                     const Vector<MultiFab>& u_in,
+                     Vector<MultiFab>& s_in,
+                     const RealVector& p0_in,
+                     const RealVector& gamma1bar_in,
+                     const Vector<MultiFab>& S_cc_in)
 {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::PlotFileMF()",PlotFileMF);
 
+    const int nPlot = varnames.size();
+    const int nOut = plot_varnames.size();
+
+    // output component of each variable of the full list, or -1 if the
+    // variable is not written
+    Vector<int> out_comp(nPlot, -1);
+    for (int n = 0; n < nOut; ++n) {
+        for (int comp = 0; comp < nPlot; ++comp) {
+            if (plot_varnames[n] == varnames[comp]) {
+                out_comp[comp] = n;
+                break;
+            }
+        }
+    }
+
+    // is any of the ncomp variables of the full list starting at comp written?
+    auto wanted = [&out_comp] (const int comp, const int ncomp=1) {
+        for (int n = comp; n < comp+ncomp; ++n) {
+            if (out_comp[n] >= 0) return true;
+        }
+        return false;
+    };
+
     // MultiFab to hold plotfile data
     Vector<const MultiFab*> plot_mf;
 
     // temporary MultiFab to hold plotfile data
     Vector<MultiFab*> plot_mf_data(finest_level+1);
 
+    // copy components srccomp.. of src into the variables comp.. of the
+    // full list that are written
+    auto copy_out = [&] (const Vector<MultiFab>& src, const int srccomp,
+                         const int comp, const int ncomp=1) {
+        for (int n = 0; n < ncomp; ++n) {
+            if (out_comp[comp+n] >= 0) {
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(*plot_mf_data[i], src[i], srccomp+n, out_comp[comp+n], 1, 0);
+                }
+            }
+        }
+    };
+
     // temporary MultiFab for calculations
     Vector<MultiFab> tempmf(finest_level+1);
     Vector<MultiFab> tempmf_scalar1(finest_level+1);
@@ -252,11 +703,11 @@ Maestro::PlotFileMF (const int nPlot,
     tempbar_plot.shrink_to_fit();
     std::fill(tempbar_plot.begin(), tempbar_plot.end(), 0.);
 
-    int dest_comp = 0;
+    int comp = 0;
 
     // build temporary MultiFab to hold plotfile data
     for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i] = new MultiFab((s_in[i]).boxArray(),(s_in[i]).DistributionMap(),nPlot,0);
+        plot_mf_data[i] = new MultiFab((s_in[i]).boxArray(),(s_in[i]).DistributionMap(),nOut,0);
         tempmf[i].define(grids[i],dmap[i],AMREX_SPACEDIM,0);
 
         tempmf_scalar1[i].define(grids[i],dmap[i],1,0);
@@ -264,474 +715,485 @@ Maestro::PlotFileMF (const int nPlot,
     }
 
     // velocity
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(u_in[i],0,dest_comp,AMREX_SPACEDIM);
-    }
-    dest_comp += AMREX_SPACEDIM;
+    copy_out(u_in, 0, comp, AMREX_SPACEDIM);
+    comp += AMREX_SPACEDIM;
 
-    // magvel
-    MakeMagvel(u_in, tempmf);
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
-    }
-    ++dest_comp;
-
-    // momentum = magvel * rho
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
-        MultiFab::Multiply(*plot_mf_data[i], s_in[i], Rho, dest_comp, 1, 0);
+    // magvel, momentum = magvel * rho
+    if (wanted(comp, 2)) {
+        MakeMagvel(u_in, tempmf);
+        copy_out(tempmf, 0, comp);
+        for (int i = 0; i <= finest_level; ++i) {
+            MultiFab::Multiply(tempmf[i], s_in[i], Rho, 0, 1, 0);
+        }
+        copy_out(tempmf, 0, comp+1);
     }
-    ++dest_comp;
+    comp += 2;
 
     // vorticity
-    MakeVorticity(u_in, tempmf);
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+    if (wanted(comp)) {
+        MakeVorticity(u_in, tempmf);
+        copy_out(tempmf, 0, comp);
     }
-    ++dest_comp;
+    ++comp;
 
     // rho
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],Rho,dest_comp,1);
-    }
-    ++dest_comp;
+    copy_out(s_in, Rho, comp);
+    ++comp;
 
     // rhoh
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],RhoH,dest_comp,1);
-    }
-    ++dest_comp;
+    copy_out(s_in, RhoH, comp);
+    ++comp;
 
     // h
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],RhoH,dest_comp,1);
-        MultiFab::Divide(*plot_mf_data[i], s_in[i], Rho, dest_comp, 1, 0);
+    if (wanted(comp)) {
+        for (int i = 0; i <= finest_level; ++i) {
+            MultiFab::Copy(tempmf[i], s_in[i], RhoH, 0, 1, 0);
+            MultiFab::Divide(tempmf[i], s_in[i], Rho, 0, 1, 0);
+        }
+        copy_out(tempmf, 0, comp);
     }
-    ++dest_comp;
+    ++comp;
 
     // rhoX
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],FirstSpec,dest_comp,NumSpec);
-    }
-    dest_comp += NumSpec;
+    copy_out(s_in, FirstSpec, comp, NumSpec);
+    comp += NumSpec;
 
     if (plot_spec) {
         // X
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(s_in[i],FirstSpec,dest_comp,NumSpec);
-            for (int comp=0; comp<NumSpec; ++comp) {
-                MultiFab::Divide(*plot_mf_data[i],s_in[i],Rho,dest_comp+comp,1,0);
+        for (int n = 0; n < NumSpec; ++n) {
+            if (wanted(comp+n)) {
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Copy(*plot_mf_data[i], s_in[i], FirstSpec+n, out_comp[comp+n], 1, 0);
+                    MultiFab::Divide(*plot_mf_data[i], s_in[i], Rho, out_comp[comp+n], 1, 0);
+                }
             }
         }
-        dest_comp += NumSpec;
+        comp += NumSpec;
 
         // abar
-        MakeAbar(s_in, tempmf);
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+        if (wanted(comp)) {
+            MakeAbar(s_in, tempmf);
+            copy_out(tempmf, 0, comp);
         }
-        ++dest_comp;
-
+        ++comp;
     }
 
-    Vector<MultiFab> stemp             (finest_level+1);
-    Vector<MultiFab> rho_Hext          (finest_level+1);
-    Vector<MultiFab> rho_omegadot      (finest_level+1);
-    Vector<MultiFab> rho_Hnuc          (finest_level+1);
-    Vector<MultiFab> sdc_source        (finest_level+1);
+    // the reaction terms are only computed if one of omegadot, Hext
+    // or Hnuc is written
+    const int nomegadot = (plot_spec || plot_omegadot) ? NumSpec : 0;
+    const int comp_omegadot = comp;
+    const int comp_Hext = comp_omegadot + nomegadot;
+    const int comp_Hnuc = comp_Hext + (plot_Hext ? 1 : 0);
+    const int nreact = comp_Hnuc + (plot_Hnuc ? 1 : 0) - comp;
 
-    for (int lev=0; lev<=finest_level; ++lev) {
-        stemp             [lev].define(grids[lev], dmap[lev],   Nscal, 0);
-        rho_Hext          [lev].define(grids[lev], dmap[lev],       1, 0);
-        rho_omegadot      [lev].define(grids[lev], dmap[lev], NumSpec, 0);
-        rho_Hnuc          [lev].define(grids[lev], dmap[lev],       1, 0);
-        sdc_source        [lev].define(grids[lev], dmap[lev],   Nscal, 0);
-        
-        sdc_source[lev].setVal(0.);
-    }
+    if (wanted(comp, nreact)) {
+
+        Vector<MultiFab> stemp             (finest_level+1);
+        Vector<MultiFab> rho_Hext          (finest_level+1);
+        Vector<MultiFab> rho_omegadot      (finest_level+1);
+        Vector<MultiFab> rho_Hnuc          (finest_level+1);
+        Vector<MultiFab> sdc_source        (finest_level+1);
+
+        for (int lev=0; lev<=finest_level; ++lev) {
+            stemp             [lev].define(grids[lev], dmap[lev],   Nscal, 0);
+            rho_Hext          [lev].define(grids[lev], dmap[lev],       1, 0);
+            rho_omegadot      [lev].define(grids[lev], dmap[lev], NumSpec, 0);
+            rho_Hnuc          [lev].define(grids[lev], dmap[lev],       1, 0);
+            sdc_source        [lev].define(grids[lev], dmap[lev],   Nscal, 0);
+
+            sdc_source[lev].setVal(0.);
+        }
 
 #ifndef SDC
-    if (dt_in < small_dt) {
-        React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, small_dt, t_in);
-    } else {
-        React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, dt_in*0.5, t_in);
-    }
-#else   
-    if (dt_in < small_dt) {
-        ReactSDC(s_in, stemp, rho_Hext, p0_in, small_dt, t_in, sdc_source);
-    } else {
-        ReactSDC(s_in, stemp, rho_Hext, p0_in, dt_in*0.5, t_in, sdc_source);
-    }
-    
-    MakeReactionRates(rho_omegadot,rho_Hnuc,s_in);
+        if (dt_in < small_dt) {
+            React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, small_dt, t_in);
+        } else {
+            React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, dt_in*0.5, t_in);
+        }
+#else
+        if (dt_in < small_dt) {
+            ReactSDC(s_in, stemp, rho_Hext, p0_in, small_dt, t_in, sdc_source);
+        } else {
+            ReactSDC(s_in, stemp, rho_Hext, p0_in, dt_in*0.5, t_in, sdc_source);
+        }
+
+        MakeReactionRates(rho_omegadot,rho_Hnuc,s_in);
 #endif
 
-    if (plot_spec || plot_omegadot) {
-        // omegadot
-        if (plot_omegadot) {
-            for (int i = 0; i <= finest_level; ++i) {
-                plot_mf_data[i]->copy(rho_omegadot[i],0,dest_comp,NumSpec);
-                for (int comp=0; comp<NumSpec; ++comp) {
-                    MultiFab::Divide(*plot_mf_data[i],s_in[i],Rho,dest_comp+comp,1,0);
-                }
+        // omegadot, Hext and Hnuc are per unit mass
+        for (int i = 0; i <= finest_level; ++i) {
+            for (int n = 0; n < NumSpec; ++n) {
+                MultiFab::Divide(rho_omegadot[i], s_in[i], Rho, n, 1, 0);
             }
-            dest_comp += NumSpec;
+            MultiFab::Divide(rho_Hext[i], s_in[i], Rho, 0, 1, 0);
+            MultiFab::Divide(rho_Hnuc[i], s_in[i], Rho, 0, 1, 0);
         }
-    }
 
-    if (plot_Hext) {
-        // Hext
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(rho_Hext[i],0,dest_comp,1);
-            MultiFab::Divide(*plot_mf_data[i],s_in[i],Rho,dest_comp,1,0);
+        copy_out(rho_omegadot, 0, comp_omegadot, nomegadot);
+        if (plot_Hext) {
+            copy_out(rho_Hext, 0, comp_Hext);
         }
-        ++dest_comp;
-    }
-
-    if (plot_Hnuc) {
-        // Hnuc
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(rho_Hnuc[i],0,dest_comp,1);
-            MultiFab::Divide(*plot_mf_data[i],s_in[i],Rho,dest_comp,1,0);
+        if (plot_Hnuc) {
+            copy_out(rho_Hnuc, 0, comp_Hnuc);
         }
-        ++dest_comp;
     }
+    comp += nreact;
 
     if (plot_eta) {
         // eta_rho
-        Put1dArrayOnCart(etarho_cc,tempmf,1,0,bcs_u,0,1);
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+        if (wanted(comp)) {
+            Put1dArrayOnCart(etarho_cc,tempmf,1,0,bcs_u,0,1);
+            copy_out(tempmf, 0, comp);
         }
-        ++dest_comp;
+        ++comp;
     }
 
-    // compute tfromp
-    TfromRhoP(s_in,p0_in);
-    // tfromp
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],Temp,dest_comp,1);
-    }
-    ++dest_comp;
+    // tfromp, tfromh, deltap and deltaT = (tfromp - tfromh) / tfromh
+    const int comp_tfromp = comp;
+    const int comp_tfromh = comp+1;
+    const int comp_deltap = comp+2;
+    const int comp_deltaT = comp+3;
+    const bool need_tfromp = wanted(comp_tfromp) || wanted(comp_deltaT);
+    const bool need_tfromh = wanted(comp_tfromh) || wanted(comp_deltap) || wanted(comp_deltaT);
 
-    // compute tfromh
-    TfromRhoH(s_in,p0_in);
-    for (int i = 0; i <= finest_level; ++i) {
-        // tfromh
-        plot_mf_data[i]->copy(s_in[i],Temp,dest_comp,1);
+    if (need_tfromp) {
+        TfromRhoP(s_in,p0_in);
+        copy_out(s_in, Temp, comp_tfromp);
+        for (int i = 0; i <= finest_level; ++i) {
+            MultiFab::Copy(tempmf_scalar1[i], s_in[i], Temp, 0, 1, 0);
+        }
     }
-    ++dest_comp;
 
-    // deltap
-    // compute & copy tfromp
-    PfromRhoH(s_in,s_in,tempmf);
-    for (int i = 0; i <= finest_level; ++i) {
-        // tfromh
-        plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
-        MultiFab::Subtract(*plot_mf_data[i],p0_cart[i],0,dest_comp,1,0);
+    if (need_tfromh) {
+        TfromRhoH(s_in,p0_in);
+        copy_out(s_in, Temp, comp_tfromh);
     }
-    ++dest_comp;
 
-    // deltaT
-    // compute & copy tfromp
-    TfromRhoP(s_in,p0_in);
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],Temp,dest_comp,1);
+    if (wanted(comp_deltap)) {
+        PfromRhoH(s_in,s_in,tempmf);
+        for (int i = 0; i <= finest_level; ++i) {
+            MultiFab::Subtract(tempmf[i],p0_cart[i],0,0,1,0);
+        }
+        copy_out(tempmf, 0, comp_deltap);
     }
-    // compute tfromh
-    TfromRhoH(s_in,p0_in);
-    // compute deltaT = (tfromp - tfromh) / tfromh
-    for (int i = 0; i <= finest_level; ++i) {
-        MultiFab::Subtract(*plot_mf_data[i],s_in[i],Temp,dest_comp,1,0);
-        MultiFab::Divide(*plot_mf_data[i],s_in[i],Temp,dest_comp,1,0);
+
+    if (wanted(comp_deltaT)) {
+        for (int i = 0; i <= finest_level; ++i) {
+            MultiFab::Subtract(tempmf_scalar1[i],s_in[i],Temp,0,1,0);
+            MultiFab::Divide(tempmf_scalar1[i],s_in[i],Temp,0,1,0);
+        }
+        copy_out(tempmf_scalar1, 0, comp_deltaT);
     }
-    ++dest_comp;
+    comp += 4;
 
-    // restore tfromp if necessary
+    // leave the temperature in the state as tfromp or tfromh, as the
+    // rest of the plot variables (and the time step loop) expect
     if (use_tfromp) {
-        TfromRhoP(s_in,p0_in);
+        if (need_tfromh || !need_tfromp) {
+            TfromRhoP(s_in,p0_in);
+        }
+    } else if (!need_tfromh) {
+        TfromRhoH(s_in,p0_in);
     }
 
     // pi
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],Pi,dest_comp,1);
-    }
-    ++dest_comp;
+    copy_out(s_in, Pi, comp);
+    ++comp;
 
     // pioverp0
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],Pi,dest_comp,1);
-        MultiFab::Divide(*plot_mf_data[i], p0_cart[i], 0, dest_comp, 1, 0);
+    if (wanted(comp)) {
+        for (int i = 0; i <= finest_level; ++i) {
+            MultiFab::Copy(tempmf[i], s_in[i], Pi, 0, 1, 0);
+            MultiFab::Divide(tempmf[i], p0_cart[i], 0, 0, 1, 0);
+        }
+        copy_out(tempmf, 0, comp);
     }
-    ++dest_comp;
+    ++comp;
 
     // p0pluspi
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],Pi,dest_comp,1);
-        MultiFab::Add(*plot_mf_data[i], p0_cart[i], 0, dest_comp, 1, 0);
+    if (wanted(comp)) {
+        for (int i = 0; i <= finest_level; ++i) {
+            MultiFab::Copy(tempmf[i], s_in[i], Pi, 0, 1, 0);
+            MultiFab::Add(tempmf[i], p0_cart[i], 0, 0, 1, 0);
+        }
+        copy_out(tempmf, 0, comp);
     }
-    ++dest_comp;
+    ++comp;
 
     if (plot_gpi) {
         // gpi
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(gpi[i],0,dest_comp,AMREX_SPACEDIM);
-        }
-        dest_comp += AMREX_SPACEDIM;
+        copy_out(gpi, 0, comp, AMREX_SPACEDIM);
+        comp += AMREX_SPACEDIM;
     }
 
     // rhopert
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],Rho,dest_comp,1);
-        MultiFab::Subtract(*plot_mf_data[i],rho0_cart[i],0,dest_comp,1,0);
+    if (wanted(comp)) {
+        for (int i = 0; i <= finest_level; ++i) {
+            MultiFab::Copy(tempmf[i], s_in[i], Rho, 0, 1, 0);
+            MultiFab::Subtract(tempmf[i], rho0_cart[i], 0, 0, 1, 0);
+        }
+        copy_out(tempmf, 0, comp);
     }
-    ++dest_comp;
+    ++comp;
 
     // rhohpert
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],RhoH,dest_comp,1);
-        MultiFab::Subtract(*plot_mf_data[i],rhoh0_cart[i],0,dest_comp,1,0);
+    if (wanted(comp)) {
+        for (int i = 0; i <= finest_level; ++i) {
+            MultiFab::Copy(tempmf[i], s_in[i], RhoH, 0, 1, 0);
+            MultiFab::Subtract(tempmf[i], rhoh0_cart[i], 0, 0, 1, 0);
+        }
+        copy_out(tempmf, 0, comp);
     }
-    ++dest_comp;
+    ++comp;
 
     // tpert
-    {
+    if (wanted(comp)) {
         Average(s_in, tempbar_plot, Temp);
         Put1dArrayOnCart(tempbar_plot,tempmf,0,0,bcs_f,0);
 
         for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(s_in[i],Temp,dest_comp,1);
-            MultiFab::Subtract(*plot_mf_data[i],tempmf[i],0,dest_comp,1,0);
+            MultiFab::Copy(tempmf_scalar1[i], s_in[i], Temp, 0, 1, 0);
+            MultiFab::Subtract(tempmf_scalar1[i], tempmf[i], 0, 0, 1, 0);
         }
+        copy_out(tempmf_scalar1, 0, comp);
     }
-    ++dest_comp;
+    ++comp;
 
     if (plot_base_state) {
         // rho0, rhoh0, h0 and p0
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy( rho0_cart[i],0,dest_comp,1);
-            plot_mf_data[i]->copy(rhoh0_cart[i],0,dest_comp+1,1);
-            plot_mf_data[i]->copy(rhoh0_cart[i],0,dest_comp+2,1);
+        copy_out(rho0_cart, 0, comp);
+        copy_out(rhoh0_cart, 0, comp+1);
 
+        if (wanted(comp+2)) {
             // we have to use protected_divide here to guard against division by zero
             // in the case that there are zeros rho0
-            MultiFab& plot_mf_data_mf = *plot_mf_data[i];
-            for ( MFIter mfi(plot_mf_data_mf); mfi.isValid(); ++mfi ) {
-                plot_mf_data_mf[mfi].protected_divide<RunOn::Device>(plot_mf_data_mf[mfi], dest_comp, dest_comp+2);
+            for (int i = 0; i <= finest_level; ++i) {
+                MultiFab::Copy(tempmf_scalar1[i], rhoh0_cart[i], 0, 0, 1, 0);
+                MultiFab::Copy(tempmf_scalar2[i], rho0_cart[i], 0, 0, 1, 0);
+                for ( MFIter mfi(tempmf_scalar1[i]); mfi.isValid(); ++mfi ) {
+                    tempmf_scalar1[i][mfi].protected_divide<RunOn::Device>(tempmf_scalar2[i][mfi], 0, 0);
+                }
             }
-
-            plot_mf_data[i]->copy(p0_cart[i],0,dest_comp+3,1);
+            copy_out(tempmf_scalar1, 0, comp+2);
         }
-        dest_comp += 4;
+
+        copy_out(p0_cart, 0, comp+3);
+        comp += 4;
     }
 
+    // w0 on the cartesian grid, needed for the Mach number, divw0 and
+    // the radial and circular velocities.  It is only built on first use
     Vector<std::array< MultiFab, AMREX_SPACEDIM > > w0mac(finest_level+1);
     Vector<MultiFab> w0r_cart(finest_level+1);
+    bool have_w0 = false;
 
-    for (int lev=0; lev<=finest_level; ++lev) {
-        if (spherical == 1) {
-            // w0mac will contain an edge-centered w0 on a Cartesian grid,
-            // for use in computing divergences.
-            AMREX_D_TERM(w0mac[lev][0].define(convert(grids[lev],nodal_flag_x), dmap[lev], 1, 1); ,
-                         w0mac[lev][1].define(convert(grids[lev],nodal_flag_y), dmap[lev], 1, 1); ,
-                         w0mac[lev][2].define(convert(grids[lev],nodal_flag_z), dmap[lev], 1, 1); );
-            for (int idim=0; idim<AMREX_SPACEDIM; ++idim) {
-                w0mac[lev][idim].setVal(0.);
-            }
-        }
+    auto make_w0 = [&] () {
+        if (have_w0) return;
+        have_w0 = true;
 
-        // w0r_cart is w0 but onto a Cartesian grid in cell-centered as
-        // a scalar.  Since w0 is the radial expansion velocity, w0r_cart
-        // is the radial w0 in a zone
-        w0r_cart[lev].define(grids[lev], dmap[lev], 1, 1);
-        w0r_cart[lev].setVal(0.);
-    }
+        for (int lev=0; lev<=finest_level; ++lev) {
+            if (spherical == 1) {
+                // w0mac will contain an edge-centered w0 on a Cartesian grid,
+                // for use in computing divergences.
+                AMREX_D_TERM(w0mac[lev][0].define(convert(grids[lev],nodal_flag_x), dmap[lev], 1, 1); ,
+                             w0mac[lev][1].define(convert(grids[lev],nodal_flag_y), dmap[lev], 1, 1); ,
+                             w0mac[lev][2].define(convert(grids[lev],nodal_flag_z), dmap[lev], 1, 1); );
+                for (int idim=0; idim<AMREX_SPACEDIM; ++idim) {
+                    w0mac[lev][idim].setVal(0.);
+                }
+            }
 
-    if (evolve_base_state == 1) {
-        if (spherical == 1) {
-            MakeW0mac(w0mac);
+            // w0r_cart is w0 but onto a Cartesian grid in cell-centered as
+            // a scalar.  Since w0 is the radial expansion velocity, w0r_cart
+            // is the radial w0 in a zone
+            w0r_cart[lev].define(grids[lev], dmap[lev], 1, 1);
+            w0r_cart[lev].setVal(0.);
         }
-        Put1dArrayOnCart(w0,w0r_cart,1,0,bcs_u,0);
-    }
 
-    // Mach number
-    MachfromRhoH(s_in,u_in,p0_in,w0r_cart,tempmf);
+        if (evolve_base_state == 1) {
+            if (spherical == 1) {
+                MakeW0mac(w0mac);
+            }
+            Put1dArrayOnCart(w0,w0r_cart,1,0,bcs_u,0);
+        }
+    };
 
     // MachNumber
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+    if (wanted(comp)) {
+        make_w0();
+        MachfromRhoH(s_in,u_in,p0_in,w0r_cart,tempmf);
+        copy_out(tempmf, 0, comp);
     }
-    ++dest_comp;
+    ++comp;
 
     // deltagamma
-    MakeDeltaGamma(s_in, p0_in, p0_cart, gamma1bar_in, gamma1bar_cart, tempmf);
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+    if (wanted(comp)) {
+        MakeDeltaGamma(s_in, p0_in, p0_cart, gamma1bar_in, gamma1bar_cart, tempmf);
+        copy_out(tempmf, 0, comp);
     }
-    ++dest_comp;
+    ++comp;
 
-    // entropy
-    MakeEntropy(s_in, tempmf);
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
-    }
-    ++dest_comp;
+    // entropy, entropypert = (entropy - entropybar) / entropybar
+    if (wanted(comp, 2)) {
+        MakeEntropy(s_in, tempmf);
+        copy_out(tempmf, 0, comp);
 
-    // entropypert = (entropy - entropybar) / entropybar
-    {
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
-        }
+        if (wanted(comp+1)) {
+            for (int i = 0; i <= finest_level; ++i) {
+                MultiFab::Copy(tempmf_scalar1[i], tempmf[i], 0, 0, 1, 0);
+            }
 
-        Average(tempmf, tempbar_plot, 0);
-        Put1dArrayOnCart(tempbar_plot,tempmf,0,0,bcs_f,0);
+            Average(tempmf, tempbar_plot, 0);
+            Put1dArrayOnCart(tempbar_plot,tempmf,0,0,bcs_f,0);
 
-        for (int i = 0; i <= finest_level; ++i) {
-            MultiFab::Subtract(*plot_mf_data[i],tempmf[i],0,dest_comp,1,0);
-            MultiFab::Divide(*plot_mf_data[i],tempmf[i],0,dest_comp,1,0);
+            for (int i = 0; i <= finest_level; ++i) {
+                MultiFab::Subtract(tempmf_scalar1[i],tempmf[i],0,0,1,0);
+                MultiFab::Divide(tempmf_scalar1[i],tempmf[i],0,0,1,0);
+            }
+            copy_out(tempmf_scalar1, 0, comp+1);
         }
     }
-    ++dest_comp;
+    comp += 2;
 
     if (plot_pidivu) {
         // pidivu
-        MakePiDivu(u_in, s_in, tempmf);
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+        if (wanted(comp)) {
+            MakePiDivu(u_in, s_in, tempmf);
+            copy_out(tempmf, 0, comp);
         }
-        ++dest_comp;
+        ++comp;
     }
 
     // processor number of each tile
     if (plot_processors) {
-        for (int i = 0; i <= finest_level; ++i) {
-            (*plot_mf_data[i]).setVal(ParallelDescriptor::MyProc());
+        if (wanted(comp)) {
+            for (int i = 0; i <= finest_level; ++i) {
+                plot_mf_data[i]->setVal(ParallelDescriptor::MyProc(), out_comp[comp], 1);
+            }
         }
-        ++dest_comp;
+        ++comp;
     }
 
     if (plot_ad_excess) {
         // ad_excess
-        MakeAdExcess(s_in, tempmf);
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+        if (wanted(comp)) {
+            MakeAdExcess(s_in, tempmf);
+            copy_out(tempmf, 0, comp);
         }
-        ++dest_comp;
+        ++comp;
     }
 
     // S
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(S_cc_in[i],0,dest_comp,1);
-    }
-    ++dest_comp;
+    copy_out(S_cc_in, 0, comp);
+    ++comp;
 
     // soundspeed
     if (plot_cs) {
-        CsfromRhoH(s_in, p0_in, p0_cart, tempmf);
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+        if (wanted(comp)) {
+            CsfromRhoH(s_in, p0_in, p0_cart, tempmf);
+            copy_out(tempmf, 0, comp);
         }
-        ++dest_comp;
+        ++comp;
     }
 
     // gravitational_acceleration
     if (plot_grav) {
-        MakeGrav(rho0_new, tempmf);
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+        if (wanted(comp)) {
+            MakeGrav(rho0_new, tempmf);
+            copy_out(tempmf, 0, comp);
         }
-        ++dest_comp;
+        ++comp;
     }
 
     if (plot_base_state) {
         // w0
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(w0_cart[i],0,dest_comp,AMREX_SPACEDIM);
-        }
-        dest_comp += AMREX_SPACEDIM;
+        copy_out(w0_cart, 0, comp, AMREX_SPACEDIM);
+        comp += AMREX_SPACEDIM;
 
         // divw0
-        MakeDivw0(w0mac, tempmf);
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+        if (wanted(comp)) {
+            make_w0();
+            MakeDivw0(w0mac, tempmf);
+            copy_out(tempmf, 0, comp);
         }
-        dest_comp++;
+        comp++;
     }
 
-    // thermal
-    Vector<MultiFab> Tcoeff            (finest_level+1);
-    Vector<MultiFab> hcoeff            (finest_level+1);
-    Vector<MultiFab> Xkcoeff           (finest_level+1);
-    Vector<MultiFab> pcoeff            (finest_level+1);
+    // thermal and conductivity
+    if (wanted(comp, 2)) {
+        Vector<MultiFab> Tcoeff            (finest_level+1);
+        Vector<MultiFab> hcoeff            (finest_level+1);
+        Vector<MultiFab> Xkcoeff           (finest_level+1);
+        Vector<MultiFab> pcoeff            (finest_level+1);
 
-    for (int lev=0; lev<=finest_level; ++lev) {
-        Tcoeff            [lev].define(grids[lev], dmap[lev],       1, 1);
-        hcoeff            [lev].define(grids[lev], dmap[lev],       1, 1);
-        Xkcoeff           [lev].define(grids[lev], dmap[lev], NumSpec, 1);
-        pcoeff            [lev].define(grids[lev], dmap[lev],       1, 1);
-    }
-
-    if (use_thermal_diffusion) {
-        MakeThermalCoeffs(s_in,Tcoeff,hcoeff,Xkcoeff,pcoeff);
-        MakeExplicitThermal(tempmf,s_in,Tcoeff,hcoeff,Xkcoeff,pcoeff,p0_in,0);
-    } else {
         for (int lev=0; lev<=finest_level; ++lev) {
-            Tcoeff[lev].setVal(0.);
-            tempmf[lev].setVal(0.);
+            Tcoeff            [lev].define(grids[lev], dmap[lev],       1, 1);
+            hcoeff            [lev].define(grids[lev], dmap[lev],       1, 1);
+            Xkcoeff           [lev].define(grids[lev], dmap[lev], NumSpec, 1);
+            pcoeff            [lev].define(grids[lev], dmap[lev],       1, 1);
         }
-    }
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
-    }
-    dest_comp++;
 
-    // conductivity
-    for (int i = 0; i <= finest_level; ++i) {
-        tempmf[i].setVal(0.);
-        plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
-        MultiFab::Subtract(*plot_mf_data[i],Tcoeff[i],0,dest_comp,1,0);
+        if (use_thermal_diffusion) {
+            MakeThermalCoeffs(s_in,Tcoeff,hcoeff,Xkcoeff,pcoeff);
+            if (wanted(comp)) {
+                MakeExplicitThermal(tempmf,s_in,Tcoeff,hcoeff,Xkcoeff,pcoeff,p0_in,0);
+            }
+        } else {
+            for (int lev=0; lev<=finest_level; ++lev) {
+                Tcoeff[lev].setVal(0.);
+                tempmf[lev].setVal(0.);
+            }
+        }
+        copy_out(tempmf, 0, comp);
+
+        // conductivity
+        for (int i = 0; i <= finest_level; ++i) {
+            Tcoeff[i].mult(-1.0, 0, 1);
+        }
+        copy_out(Tcoeff, 0, comp+1);
     }
-    dest_comp++;
+    comp += 2;
 
     // radial and circular velocities
     if (spherical == 1) {
-        MakeVelrc(u_in, w0r_cart, tempmf, tempmf_scalar1);
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
-            plot_mf_data[i]->copy(tempmf_scalar1[i],0,dest_comp+1,1);
+        if (wanted(comp, 2)) {
+            make_w0();
+            MakeVelrc(u_in, w0r_cart, tempmf, tempmf_scalar1);
+            copy_out(tempmf, 0, comp);
+            copy_out(tempmf_scalar1, 0, comp+1);
         }
-        dest_comp += 2;
+        comp += 2;
     }
 
     if (do_sponge) {
-        SpongeInit(rho0_old);
-        MakeSponge(tempmf);
-
-        if (plot_sponge_fdamp) {
-            // compute f_damp assuming sponge=1/(1+dt*kappa*fdamp)
-            // therefore fdamp = (1/sponge-1)/(dt*kappa)
-            for (int i = 0; i <= finest_level; ++i) {
-                // scalar1 = 1
-                tempmf_scalar1[i].setVal(1.);
-                // scalar2 = dt * kappa
-                tempmf_scalar2[i].setVal(dt * sponge_kappa);
-                // plot_mf = 1
-                plot_mf_data[i]->copy(tempmf_scalar1[i],0,dest_comp,1);
-                // plot_mf = 1/sponge
-                MultiFab::Divide(*plot_mf_data[i],tempmf[i],0,dest_comp,1,0);
-                // plot_mf = 1/sponge - 1
-                MultiFab::Subtract(*plot_mf_data[i],tempmf_scalar1[i],0,dest_comp,1,0);
-                // plot_mf = (1/sponge-1)/(dt*kappa)
-                MultiFab::Divide(*plot_mf_data[i],tempmf_scalar2[i],0,dest_comp,1,0);
-            }
-        } else {
-            for (int i = 0; i <= finest_level; ++i) {
-                plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+        if (wanted(comp)) {
+            SpongeInit(rho0_old);
+            MakeSponge(tempmf);
+
+            if (plot_sponge_fdamp) {
+                // compute f_damp assuming sponge=1/(1+dt*kappa*fdamp)
+                // therefore fdamp = (1/sponge-1)/(dt*kappa)
+                for (int i = 0; i <= finest_level; ++i) {
+                    // scalar2 = dt * kappa
+                    tempmf_scalar2[i].setVal(dt * sponge_kappa);
+                    // scalar1 = 1/sponge
+                    tempmf_scalar1[i].setVal(1.);
+                    MultiFab::Divide(tempmf_scalar1[i],tempmf[i],0,0,1,0);
+                    // scalar1 = 1/sponge - 1
+                    tempmf_scalar1[i].plus(-1.0,0,1);
+                    // scalar1 = (1/sponge-1)/(dt*kappa)
+                    MultiFab::Divide(tempmf_scalar1[i],tempmf_scalar2[i],0,0,1,0);
+                }
+                copy_out(tempmf_scalar1, 0, comp);
+            } else {
+                copy_out(tempmf, 0, comp);
             }
         }
-        dest_comp++;
+        comp++;
     }
 
+    AMREX_ASSERT(comp == nPlot);
+
     // add plot_mf_data[i] to plot_mf
     for (int i = 0; i <= finest_level; ++i) {
         plot_mf.push_back(plot_mf_data[i]);
@@ -740,53 +1202,6 @@ Maestro::PlotFileMF (const int nPlot,
     return plot_mf;
 }
 
-
-// this takes the multifab of all variables and extracts those
-// required for the small plot file
-Vector<const MultiFab*>
-Maestro::SmallPlotFileMF(const int nPlot, const int nSmallPlot,
-                         Vector<const MultiFab*> mf,
-                         const Vector<std::string> varnames,
-                         const Vector<std::string> small_plot_varnames)
-{
-    // timer for profiling
-    BL_PROFILE_VAR("Maestro::SmallPlotFileMF()",SmallPlotFileMF);
-
-    // MultiFab to hold plotfile data
-    Vector<const MultiFab*> plot_mf;
-
-    // temporary MultiFabs to hold plotfile data
-    Vector<MultiFab*> plot_mf_data(finest_level+1);
-
-    int dest_comp = 0;
-
-    // build temporary MultiFab to hold plotfile data
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i] = new MultiFab(mf[i]->boxArray(),
-                                       mf[i]->DistributionMap(),nSmallPlot,0);
-
-    }
-
-    for (auto it=small_plot_varnames.begin();
-         it!=small_plot_varnames.end(); ++it) {
-
-        for (auto n = 0; n < nPlot; n++) {
-            if (*it == varnames[n]) {
-                for (int i = 0; i <= finest_level; ++i)
-                    plot_mf_data[i]->copy(*(mf[i]), n, dest_comp, 1);
-                ++dest_comp;
-                break;
-            }
-        }
-    }
-
-    // add plot_mf_data[i] to plot_mf
-    for (int i = 0; i <= finest_level; ++i)
-        plot_mf.push_back(plot_mf_data[i]);
-
-    return plot_mf;
-}
-
 // set plotfile variable names
 Vector<std::string>
 Maestro::PlotFileVarNames (int * nPlot) const
@@ -982,75 +1397,72 @@ Maestro::PlotFileVarNames (int * nPlot) const
 
 }
 
-// set plotfile variable names
+// the words of the runtime parameter maestro.<name>, which is either a list
+// of words or a single string of words separated by spaces (as its default
+// value default_list is)
 Vector<std::string>
-Maestro::SmallPlotFileVarNames (int * nPlot, Vector<std::string> varnames) const
+Maestro::GetParamWords (const std::string& name,
+                        const std::string& default_list)
 {
-    // timer for profiling
-    BL_PROFILE_VAR("Maestro::SmallPlotFileVarNames()",SmallPlotFileVarNames);
-
-    Vector<std::string> names(*nPlot);
+    Vector<std::string> words;
 
     ParmParse pp("maestro");
 
-    int nPltVars = pp.countval("small_plot_vars");
+    int nwords = pp.countval(name.c_str());
 
-    if (nPltVars > 0) { // small_plot_vars defined in inputs file
+    if (nwords > 0) { // name defined in inputs file
+        std::string word;
 
-        std::string nm;
+        for (int i = 0; i < nwords; i++) {
+            pp.get(name.c_str(), word, i);
+            words.push_back(word);
+        }
+    } else {
+        // use default value, which is a string that needs to be split
+        std::stringstream sstream(default_list);
+        std::string word;
 
-        for (int i = 0; i < nPltVars; i++)
-        {
-            pp.get("small_plot_vars", nm, i);
+        while (sstream >> word) {
+            words.push_back(word);
+        }
+    }
 
-            if (nm == "ALL")
-                return varnames;
-            else if (nm == "NONE") {
-                names.clear();
-                return names;
-            } else {
-                // test to see if it's a valid varname by iterating over
-                // varnames
-                auto found_name = false;
-                for (auto it=varnames.begin(); it!=varnames.end(); ++it) {
-                    if (nm == *it) {
-                        names.push_back(nm);
-                        found_name = true;
-                        break;
-                    }
-                }
+    return words;
+}
 
-                if (!found_name)
-                    Print() << "Small plot file variable " << nm << " is invalid\n";
-            }
+// the variables of the full list varnames to write to a plotfile.  They
+// are read from the runtime parameter list_name with GetParamWords.  "ALL"
+// selects every variable and "NONE" none
+Vector<std::string>
+Maestro::SelectPlotFileVarNames (const std::string& list_name,
+                                 const std::string& default_list,
+                                 const Vector<std::string>& varnames) const
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::SelectPlotFileVarNames()",SelectPlotFileVarNames);
+
+    const auto& requested = GetParamWords(list_name, default_list);
+
+    Vector<std::string> names;
+
+    for (const auto& nm : requested) {
+        if (nm == "ALL") {
+            return varnames;
+        } else if (nm == "NONE") {
+            names.clear();
+            return names;
         }
-    } else {
-        // use default value of small_plot_vars which is a string that needs to be split
-        std::stringstream sstream(small_plot_vars);
-        std::string nm;
-
-        while (sstream >> nm) {
-            // test to see if it's a valid varname by iterating over
-            // varnames
-            auto found_name = false;
-            for (auto it=varnames.begin(); it!=varnames.end(); ++it) {
-                if (nm == *it) {
-                    names.push_back(nm);
-                    found_name = true;
-                    break;
-                }
-            }
 
-            if (!found_name)
-                Print() << "Small plot file variable " << nm << " is invalid\n";
+        // test to see if it's a valid varname by iterating over varnames
+        if (std::find(varnames.begin(), varnames.end(), nm) == varnames.end()) {
+            Print() << "Plot file variable " << nm << " in " << list_name
+                    << " is invalid\n";
+        } else if (std::find(names.begin(), names.end(), nm) == names.end()) {
+            names.push_back(nm);
         }
     }
 
-    names.shrink_to_fit();
-    *nPlot = names.size();
-
     return names;
-
 }
 
 void
@@ -1504,6 +1916,8 @@ Maestro::MakeAdExcess (const Vector<MultiFab>& state,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeAdExcess()", MakeAdExcess);
 
+    ThermoCacheDefine();
+
     const auto base_cutoff_density_loc = base_cutoff_density;
 
     for (int lev=0; lev<=finest_level; ++lev) {
@@ -1520,6 +1934,7 @@ Maestro::MakeAdExcess (const Vector<MultiFab>& state,
 
             // Get the index space of the valid region
             const Box& tileBox = mfi.tilebox();
+            const Array4<ThermoCacheEntry> thermo_cache_arr = ThermoCacheArray(lev, mfi);
 
             const Array4<const Real> state_arr = state[lev].array(mfi);
             const Array4<Real> ad_excess_arr = ad_excess[lev].array(mfi);
@@ -1538,7 +1953,7 @@ Maestro::MakeAdExcess (const Vector<MultiFab>& state,
                     eos_state.xn[comp] = state_arr(i,j,k,FirstSpec+comp)/eos_state.rho;
                 }
 
-                eos(eos_input_rt, eos_state);
+                eos_rt_cached(thermo_cache_arr, i, j, k, eos_state);
 
                 pres(i,j,k) = eos_state.p;
                 // Print() << "pres = " << pres(i,j,k) << std::endl;
@@ -2077,6 +2492,8 @@ Maestro::MakeEntropy (const Vector<MultiFab>& state,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeEntropy()",MakeEntropy);
 
+    ThermoCacheDefine();
+
     for (int lev=0; lev<=finest_level; ++lev) {
 
         // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
@@ -2087,6 +2504,7 @@ Maestro::MakeEntropy (const Vector<MultiFab>& state,
 
             // Get the index space of the valid region
             const Box& tileBox = mfi.tilebox();
+            const Array4<ThermoCacheEntry> thermo_cache_arr = ThermoCacheArray(lev, mfi);
 
             const Array4<const Real> state_arr = state[lev].array(mfi);
             const Array4<Real> entropy_arr = entropy[lev].array(mfi);
@@ -2100,7 +2518,7 @@ Maestro::MakeEntropy (const Vector<MultiFab>& state,
                     eos_state.xn[comp] = state_arr(i,j,k,FirstSpec+comp) / state_arr(i,j,k,Rho);
                 }
 
-                eos(eos_input_rt, eos_state);
+                eos_rt_cached(thermo_cache_arr, i, j, k, eos_state);
 
                 entropy_arr(i,j,k) = eos_state.s;
             });
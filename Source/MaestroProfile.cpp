@@ -0,0 +1,379 @@
+#include <Maestro.H>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+using namespace amrex;
+
+// Radial profiles are a cheap alternative to plotfiles for following the
+// horizontally (planar) or spherically (spherical) averaged structure of
+// a run.  Every profile_int steps (or profile_deltat in time) the mean,
+// the rms fluctuation about the mean, and the minimum and maximum of each
+// variable in profile_vars are appended to profile_file.  Any plotfile
+// variable can be used, and only the ones selected are computed.
+//
+// The file is binary.  It starts with a header
+//
+//     char     magic[8]     "MAESTRPF"
+//     uint32   endian       0x01020304 in the byte order of the writer
+//     uint32   version
+//     uint32   real_size    sizeof(Real)
+//     uint32   nvar
+//     uint64   nbin
+//     nvar times: uint32 length followed by the variable name
+//     Real     r[nbin]      radius (or height) of each bin
+//
+// followed by one record for every output
+//
+//     int64    step
+//     Real     time
+//     nvar times: Real mean[nbin], rms[nbin], min[nbin], max[nbin]
+//
+// The records are in increasing order of step.  On the first write of a
+// run, any records from step start_step on (written after the checkpoint
+// the run restarted from, or by an earlier run from scratch) are dropped
+// before appending, so the file never goes back in time.
+//
+// The bins are those of the base state on its finest level, and each bin
+// holds the data of the finest level that covers it.  The mean and rms are
+// computed by Average.  In spherical without use_exact_base_state, Average
+// interpolates onto r_cc from the irregular radii of the cell centers,
+// which cannot be done for a minimum or maximum, so those are taken over
+// the cells whose centers lie in the uniform shell of width dr_fine about
+// each r_cc.  Bins that hold no cells (outside the domain, in spherical)
+// report the mean as their minimum and maximum.
+
+namespace
+{
+    template <typename T>
+    void Append (std::string& buf, const T& val)
+    {
+        buf.append(reinterpret_cast<const char*>(&val), sizeof(T));
+    }
+
+    void Append (std::string& buf, const Vector<Real>& vals)
+    {
+        buf.append(reinterpret_cast<const char*>(vals.dataPtr()),
+                   vals.size()*sizeof(Real));
+    }
+}
+
+// compute the radial profiles of profile_vars and append them to
+// profile_file
+void
+Maestro::WriteProfiles (const int step,
+                        const Real t_in,
+                        const Real dt_in,
+                        const RealVector& rho0_in,
+                        const RealVector& rhoh0_in,
+                        const RealVector& p0_in,
+                        const RealVector& gamma1bar_in,
+                        const Vector<MultiFab>& u_in,
+                        Vector<MultiFab>& s_in,
+                        const Vector<MultiFab>& S_cc_in)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::WriteProfiles()",WriteProfiles);
+
+    // wallclock time
+    const Real strt_total = ParallelDescriptor::second();
+
+    int nPlot = 0;
+    const auto& varnames = PlotFileVarNames(&nPlot);
+    const auto& profile_varnames = SelectPlotFileVarNames("profile_vars", profile_vars,
+                                                          varnames);
+    const int nvar = profile_varnames.size();
+
+    if (nvar == 0) {
+        return;
+    }
+
+    // the base state on the cartesian grid, as PlotFileMF needs it
+    Vector<MultiFab> rho0_cart;
+    Vector<MultiFab> rhoh0_cart;
+    Vector<MultiFab> p0_cart;
+    Vector<MultiFab> gamma1bar_cart;
+    PlotFileBaseStateCart(rho0_in,rhoh0_in,p0_in,gamma1bar_in,
+                          rho0_cart,rhoh0_cart,p0_cart,gamma1bar_cart);
+
+    const auto& mf = PlotFileMF(varnames,profile_varnames,t_in,dt_in,rho0_cart,
+                                rhoh0_cart,p0_cart,gamma1bar_cart,u_in,s_in,
+                                p0_in,gamma1bar_in,S_cc_in);
+
+    // the profile variables, and their squared fluctuations about the mean
+    Vector<MultiFab> phi(finest_level+1);
+    Vector<MultiFab> phi_fluct(finest_level+1);
+    for (int lev=0; lev<=finest_level; ++lev) {
+        phi[lev] = MultiFab(*mf[lev], amrex::make_alias, 0, nvar);
+        phi_fluct[lev].define(grids[lev], dmap[lev], nvar, 0);
+    }
+
+    const int max_lev = base_geom.max_radial_level+1;
+    const int nsum = max_lev*base_geom.nr_fine;
+
+    // the means and the mean squared fluctuations, each with a single
+    // collective for all the variables
+    Vector<RealVector> phibar(nvar, RealVector(nsum, 0.0));
+    Vector<RealVector> phivar(nvar, RealVector(nsum, 0.0));
+
+    Vector<const Vector<MultiFab>*> phi_batch(nvar, &phi);
+    Vector<const Vector<MultiFab>*> fluct_batch(nvar, &phi_fluct);
+    Vector<RealVector*> phibar_batch(nvar);
+    Vector<RealVector*> phivar_batch(nvar);
+    Vector<int> comp_batch(nvar);
+    for (int n = 0; n < nvar; ++n) {
+        phibar_batch[n] = &phibar[n];
+        phivar_batch[n] = &phivar[n];
+        comp_batch[n] = n;
+    }
+
+    Average(phi_batch, phibar_batch, comp_batch);
+
+    for (int lev=0; lev<=finest_level; ++lev) {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(phi[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+
+            const Box& tileBox = mfi.tilebox();
+
+            const Array4<const Real> phi_arr = phi[lev].const_array(mfi);
+            const Array4<Real> fluct_arr = phi_fluct[lev].array(mfi);
+
+            for (int n = 0; n < nvar; ++n) {
+                const auto phibar_cart = MakeBaseStateCart(lev, mfi, phibar[n], 0);
+
+                AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
+                    const Real dphi = phi_arr(i,j,k,n) - phibar_cart(i,j,k);
+                    fluct_arr(i,j,k,n) = dphi * dphi;
+                });
+            }
+        }
+    }
+
+    Average(fluct_batch, phivar_batch, comp_batch);
+
+    // minimum and maximum of every variable in each radial bin, skipping
+    // the cells covered by a finer level
+    Vector<Real> phimin(nvar*nsum, std::numeric_limits<Real>::max());
+    Vector<Real> phimax(nvar*nsum, std::numeric_limits<Real>::lowest());
+
+    Gpu::synchronize();
+
+    for (int lev=0; lev<=finest_level; ++lev) {
+
+        iMultiFab fine_mask;
+        if (lev < finest_level) {
+            fine_mask = makeFineMask(grids[lev], dmap[lev], grids[lev+1],
+                                     refRatio(lev), 0, 1);
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            Vector<Real> thread_min(nvar*nsum, std::numeric_limits<Real>::max());
+            Vector<Real> thread_max(nvar*nsum, std::numeric_limits<Real>::lowest());
+
+            for (MFIter mfi(phi[lev], true); mfi.isValid(); ++mfi) {
+
+                const Box& tileBox = mfi.tilebox();
+                const auto lo = amrex::lbound(tileBox);
+                const auto hi = amrex::ubound(tileBox);
+
+                const Array4<const Real> phi_arr = phi[lev].const_array(mfi);
+                const Array4<const int> mask_arr = lev < finest_level ?
+                    fine_mask.const_array(mfi) : Array4<const int>();
+
+                Array4<const Real> radius_arr;
+                Array4<const Real> cc_to_r_arr;
+                if (spherical == 1) {
+                    radius_arr = cell_radius[lev].const_array(mfi);
+                    if (use_exact_base_state) {
+                        cc_to_r_arr = cell_cc_to_r[lev].const_array(mfi);
+                    }
+                }
+
+                for (int k = lo.z; k <= hi.z; ++k) {
+                    for (int j = lo.y; j <= hi.y; ++j) {
+                        for (int i = lo.x; i <= hi.x; ++i) {
+
+                            if (lev < finest_level && mask_arr(i,j,k) == 1) continue;
+
+                            // the bin of this cell.  In spherical without
+                            // use_exact_base_state this is the uniform
+                            // dr_fine shell that holds the cell center, not
+                            // the irregular radii that Average bins by
+                            // before interpolating onto r_cc
+                            int bin;
+                            if (spherical == 0) {
+                                bin = lev + max_lev*(AMREX_SPACEDIM == 2 ? j : k);
+                            } else {
+                                const int r = use_exact_base_state ?
+                                    int(std::round(cc_to_r_arr(i,j,k))) :
+                                    int(radius_arr(i,j,k) / base_geom.dr_fine);
+                                bin = amrex::min(r, base_geom.nr_fine-1);
+                            }
+
+                            for (int n = 0; n < nvar; ++n) {
+                                thread_min[n*nsum+bin] = amrex::min(thread_min[n*nsum+bin],
+                                                                    phi_arr(i,j,k,n));
+                                thread_max[n*nsum+bin] = amrex::max(thread_max[n*nsum+bin],
+                                                                    phi_arr(i,j,k,n));
+                            }
+                        }
+                    }
+                }
+            }
+
+#ifdef _OPENMP
+#pragma omp critical (profile_minmax)
+#endif
+            for (int m = 0; m < nvar*nsum; ++m) {
+                phimin[m] = amrex::min(phimin[m], thread_min[m]);
+                phimax[m] = amrex::max(phimax[m], thread_max[m]);
+            }
+        }
+    }
+
+    for (int lev=0; lev<=finest_level; ++lev) {
+        delete mf[lev];
+    }
+
+    const int ioproc = ParallelDescriptor::IOProcessorNumber();
+    ParallelDescriptor::ReduceRealMin(phimin.dataPtr(), nvar*nsum, ioproc);
+    ParallelDescriptor::ReduceRealMax(phimax.dataPtr(), nvar*nsum, ioproc);
+
+    if (ParallelDescriptor::IOProcessor()) {
+
+        const int nbin = base_geom.nr_fine;
+
+        // the base state level whose data is used for each bin of the
+        // finest level: the finest one that covers it.  The chunks only
+        // exist up to the finest level in use
+        Vector<int> bin_lev(nbin, 0);
+        for (int lev = 1; lev <= base_geom.finest_radial_level; ++lev) {
+            const int shift = base_geom.max_radial_level - lev;
+            for (int i = 1; i <= base_geom.numdisjointchunks(lev); ++i) {
+                const int lo = base_geom.r_start_coord(lev,i) << shift;
+                const int hi = ((base_geom.r_end_coord(lev,i)+1) << shift) - 1;
+                for (int r = lo; r <= amrex::min(hi, nbin-1); ++r) {
+                    bin_lev[r] = lev;
+                }
+            }
+        }
+
+        auto composite = [&] (const Real* s0, const int r) {
+            const int lev = bin_lev[r];
+            const int shift = base_geom.max_radial_level - lev;
+            return s0[lev + max_lev*(r >> shift)];
+        };
+
+        // the header, which a file being appended to must match
+        std::string header("MAESTRPF");
+        Append(header, std::uint32_t(0x01020304));
+        Append(header, std::uint32_t(1));
+        Append(header, std::uint32_t(sizeof(Real)));
+        Append(header, std::uint32_t(nvar));
+        Append(header, std::uint64_t(nbin));
+        for (const auto& name : profile_varnames) {
+            Append(header, std::uint32_t(name.size()));
+            header += name;
+        }
+        Vector<Real> r_cc(nbin);
+        for (int r = 0; r < nbin; ++r) {
+            r_cc[r] = base_geom.r_cc_loc(base_geom.max_radial_level,r);
+        }
+        Append(header, r_cc);
+
+        std::string record;
+        Append(record, std::int64_t(step));
+        Append(record, t_in);
+
+        Vector<Real> mean(nbin), rms(nbin), pmin(nbin), pmax(nbin);
+        for (int n = 0; n < nvar; ++n) {
+            for (int r = 0; r < nbin; ++r) {
+                mean[r] = composite(phibar[n].dataPtr(), r);
+                rms[r] = std::sqrt(amrex::max(composite(phivar[n].dataPtr(), r), 0.0));
+                pmin[r] = composite(&phimin[n*nsum], r);
+                pmax[r] = composite(&phimax[n*nsum], r);
+                if (pmin[r] > pmax[r]) {
+                    pmin[r] = pmax[r] = mean[r];
+                }
+            }
+            Append(record, mean);
+            Append(record, rms);
+            Append(record, pmin);
+            Append(record, pmax);
+        }
+
+        // start a new file, or check that the existing one (from before a
+        // restart) has the same variables and bins
+        bool new_file = true;
+        std::string kept;
+        bool trim = false;
+        {
+            std::ifstream existing(profile_file, std::ifstream::in | std::ifstream::binary);
+            if (existing.good()) {
+                std::string old_header(header.size(), '\0');
+                existing.read(&old_header[0], old_header.size());
+                if (existing.gcount() > 0) {
+                    new_file = false;
+                    if (existing.gcount() != std::streamsize(header.size()) ||
+                        old_header != header) {
+                        Abort("WriteProfiles: " + profile_file + " holds different variables "
+                              "or radial bins; remove or rename it");
+                    }
+                }
+            }
+
+            // on the first write of this run, keep only the records from
+            // before start_step; this run writes the later steps again
+            if (!new_file && !profile_file_trimmed) {
+                std::string old_record(record.size(), '\0');
+                while (existing.read(&old_record[0], old_record.size())) {
+                    std::int64_t old_step;
+                    std::memcpy(&old_step, old_record.data(), sizeof(old_step));
+                    if (old_step >= start_step) {
+                        break;
+                    }
+                    kept += old_record;
+                }
+                // anything left over is a later step or a partial record
+                trim = !existing.eof() || existing.gcount() > 0;
+            }
+        }
+        profile_file_trimmed = true;
+
+        if (trim) {
+            std::ofstream ProfileFile(profile_file, std::ofstream::out |
+                                      std::ofstream::trunc | std::ofstream::binary);
+            if (!ProfileFile.good()) {
+                amrex::FileOpenFailed(profile_file);
+            }
+            ProfileFile.write(header.data(), header.size());
+            ProfileFile.write(kept.data(), kept.size());
+        }
+
+        std::ofstream ProfileFile(profile_file, std::ofstream::out |
+                                  std::ofstream::app | std::ofstream::binary);
+        if (!ProfileFile.good()) {
+            amrex::FileOpenFailed(profile_file);
+        }
+        if (new_file) {
+            ProfileFile.write(header.data(), header.size());
+        }
+        ProfileFile.write(record.data(), record.size());
+    }
+
+    // wallclock time
+    Real end_total = ParallelDescriptor::second() - strt_total;
+
+    // print wallclock time
+    ParallelDescriptor::ReduceRealMax(end_total,ParallelDescriptor::IOProcessorNumber());
+    if (maestro_verbose > 0) {
+        Print() << "Time to write profiles: " << end_total << '\n';
+    }
+}
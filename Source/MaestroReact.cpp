@@ -216,6 +216,37 @@ void Maestro::Burner(const Vector<MultiFab>& s_in,
         const BoxArray& fba = s_in[finelev].boxArray();
         const iMultiFab& mask = makeFineMask(s_in_mf, fba, IntVect(2));
 
+        if (burner_use_zone_list && Gpu::notInLaunchRegion()) {
+
+            int use_mask = !(lev==finest_level);
+
+            BurnZoneList(lev, s_in_mf, mask, use_mask,
+                         [&] (const int idx, const Box& bx)
+            {
+                if (spherical == 1) {
+                    burner_loop_sphr(AMREX_INT_ANYD(bx.loVect()), AMREX_INT_ANYD(bx.hiVect()),
+                                     BL_TO_FORTRAN_ANYD(s_in_mf[idx]),
+                                     BL_TO_FORTRAN_ANYD(s_out_mf[idx]),
+                                     BL_TO_FORTRAN_ANYD(rho_Hext_mf[idx]),
+                                     BL_TO_FORTRAN_ANYD(rho_omegadot_mf[idx]),
+                                     BL_TO_FORTRAN_ANYD(rho_Hnuc_mf[idx]),
+                                     BL_TO_FORTRAN_ANYD(tempbar_cart_mf[idx]), dt_in, time_in,
+                                     BL_TO_FORTRAN_ANYD(mask[idx]), use_mask);
+                } else {
+                    burner_loop(AMREX_INT_ANYD(bx.loVect()), AMREX_INT_ANYD(bx.hiVect()),
+                                lev,
+                                BL_TO_FORTRAN_ANYD(s_in_mf[idx]),
+                                BL_TO_FORTRAN_ANYD(s_out_mf[idx]),
+                                BL_TO_FORTRAN_ANYD(rho_Hext_mf[idx]),
+                                BL_TO_FORTRAN_ANYD(rho_omegadot_mf[idx]),
+                                BL_TO_FORTRAN_ANYD(rho_Hnuc_mf[idx]),
+                                tempbar_init.dataPtr(), dt_in, time_in,
+                                BL_TO_FORTRAN_ANYD(mask[idx]), use_mask);
+                }
+            });
+
+            continue;
+        }
 
         // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
@@ -228,6 +259,9 @@ void Maestro::Burner(const Vector<MultiFab>& s_in,
 
             int use_mask = !(lev==finest_level);
 
+            // wallclock time, for weighting the load balancing
+            const Real strt_burn = ParallelDescriptor::second();
+
             // call fortran subroutine
             // use macros in AMReX_ArrayLim.H to pass in each FAB's data,
             // lo/hi coordinates (including ghost cells), and/or the # of components
@@ -254,6 +288,8 @@ void Maestro::Burner(const Vector<MultiFab>& s_in,
                             tempbar_init.dataPtr(), dt_in, time_in, 
                             BL_TO_FORTRAN_ANYD(mask[mfi]), use_mask);
             }
+
+            RecordBurnCost(lev, mfi.index(), mfi.tilebox(), ParallelDescriptor::second() - strt_burn);
         }
     }
 }
@@ -298,7 +334,36 @@ void Maestro::Burner(const Vector<MultiFab>& s_in,
 
         const BoxArray& fba = s_in[finelev].boxArray();
         const iMultiFab& mask = makeFineMask(s_in_mf, fba, IntVect(2));
-        
+
+        if (burner_use_zone_list && Gpu::notInLaunchRegion()) {
+
+            int use_mask = !(lev==finest_level);
+
+            BurnZoneList(lev, s_in_mf, mask, use_mask,
+                         [&] (const int idx, const Box& bx)
+            {
+                if (spherical == 1) {
+                    burner_loop_sphr(AMREX_INT_ANYD(bx.loVect()),
+                        AMREX_INT_ANYD(bx.hiVect()),
+                        BL_TO_FORTRAN_ANYD(s_in_mf[idx]),
+                        BL_TO_FORTRAN_ANYD(s_out_mf[idx]),
+                        BL_TO_FORTRAN_ANYD(source_mf[idx]),
+                        BL_TO_FORTRAN_ANYD(p0_cart_mf[idx]), dt_in, time_in,
+                        BL_TO_FORTRAN_ANYD(mask[idx]), use_mask);
+                } else {
+                    burner_loop(AMREX_INT_ANYD(bx.loVect()),
+                        AMREX_INT_ANYD(bx.hiVect()),
+                        lev,
+                        BL_TO_FORTRAN_ANYD(s_in_mf[idx]),
+                        BL_TO_FORTRAN_ANYD(s_out_mf[idx]),
+                        BL_TO_FORTRAN_ANYD(source_mf[idx]),
+                        p0.dataPtr(), dt_in, time_in,
+                        BL_TO_FORTRAN_ANYD(mask[idx]), use_mask);
+                }
+            });
+
+            continue;
+        }
 
         // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
@@ -311,6 +376,9 @@ void Maestro::Burner(const Vector<MultiFab>& s_in,
 
             int use_mask = !(lev==finest_level);
 
+            // wallclock time, for weighting the load balancing
+            const Real strt_burn = ParallelDescriptor::second();
+
             // call fortran subroutine
             
             if (spherical == 1) {
@@ -333,11 +401,101 @@ void Maestro::Burner(const Vector<MultiFab>& s_in,
                     p0.dataPtr(), dt_in, time_in,
                     BL_TO_FORTRAN_ANYD(mask[mfi]), use_mask);
             }
+
+            RecordBurnCost(lev, mfi.index(), mfi.tilebox(), ParallelDescriptor::second() - strt_burn);
         }
     }
 }
 #endif
 
+// build a compacted list of the zones on level lev that need a call to
+// the reaction network and burn them with dynamic scheduling, so that
+// threads are not left idle on tiles that are entirely inert.
+// burn_run(idx, bx) calls the burner on box bx of FAB idx
+void
+Maestro::BurnZoneList (const int lev,
+                       const MultiFab& s_in_mf,
+                       const iMultiFab& mask,
+                       const int use_mask,
+                       const std::function<void(const int, const Box&)>& burn_run)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::BurnZoneList()",BurnZoneList);
+
+    // each work item is a run of zones along x in a single FAB
+    Vector<std::pair<int,Box> > inert_runs;
+    Vector<std::pair<int,Box> > active_zones;
+
+    for ( MFIter mfi(s_in_mf); mfi.isValid(); ++mfi ) {
+
+        const Box& validBox = mfi.validbox();
+        const int idx = mfi.index();
+
+        IArrayBox zstate(validBox);
+
+        burner_zone_state(AMREX_INT_ANYD(validBox.loVect()), AMREX_INT_ANYD(validBox.hiVect()),
+                          BL_TO_FORTRAN_ANYD(s_in_mf[mfi]),
+                          BL_TO_FORTRAN_ANYD(mask[mfi]), use_mask,
+                          BL_TO_FORTRAN_ANYD(zstate));
+
+        const auto zs = zstate.array();
+        const auto lo = amrex::lbound(validBox);
+        const auto hi = amrex::ubound(validBox);
+
+        for (auto k = lo.z; k <= hi.z; ++k) {
+            for (auto j = lo.y; j <= hi.y; ++j) {
+                auto i = lo.x;
+                while (i <= hi.x) {
+                    const int state = zs(i,j,k);
+                    const auto ilo = i;
+                    while (i <= hi.x && zs(i,j,k) == state) {
+                        ++i;
+                    }
+
+                    if (state == 1) {
+                        // inert zones are cheap, so keep the whole run together
+                        inert_runs.push_back({idx, Box(IntVect(AMREX_D_DECL(ilo,j,k)),
+                                                       IntVect(AMREX_D_DECL(i-1,j,k)))});
+                    } else if (state == 2) {
+                        for (auto ii = ilo; ii < i; ++ii) {
+                            const IntVect iv(AMREX_D_DECL(ii,j,k));
+                            active_zones.push_back({idx, Box(iv,iv)});
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    const int n_inert = inert_runs.size();
+    const int n_active = active_zones.size();
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+#ifdef _OPENMP
+#pragma omp for schedule(static) nowait
+#endif
+        for (int n = 0; n < n_inert; ++n) {
+            burn_run(inert_runs[n].first, inert_runs[n].second);
+        }
+
+        // the integration cost of a zone varies by orders of magnitude,
+        // so hand the zones out to the threads as they become free
+#ifdef _OPENMP
+#pragma omp for schedule(guided)
+#endif
+        for (int n = 0; n < n_active; ++n) {
+            const Real strt_burn = ParallelDescriptor::second();
+
+            burn_run(active_zones[n].first, active_zones[n].second);
+
+            RecordBurnCost(lev, active_zones[n].first, active_zones[n].second,
+                           ParallelDescriptor::second() - strt_burn);
+        }
+    }
+}
 
 // compute heating terms, rho_omegadot and rho_Hnuc
 void
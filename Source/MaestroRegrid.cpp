@@ -61,6 +61,11 @@ Maestro::Regrid ()
         rho0_temp.copy(rho0_old);
     }
 
+    // none of the scratch MultiFabs or linear operators can be reused
+    // on the new grids
+    ScratchClear();
+    SolverClear();
+
     // regrid could add newly refine levels (if finest_level < max_level)
     // so we save the previous finest level index
     regrid(0, t_old);
@@ -71,8 +76,8 @@ Maestro::Regrid ()
     }
     init_multilevel(tag_array.dataPtr(),&finest_level);
     // InitMultilevel(finest_level);
-    BaseState<int> tag_array_b(tag_array, base_geom.max_radial_level+1, base_geom.nr_fine);
-    base_geom.InitMultiLevel(finest_level, tag_array_b.array());
+    base_geom.InitMultiLevel(finest_level,
+        makeRadialBaseStateArray(tag_array, base_geom.max_radial_level+1, base_geom.nr_fine));
 
     if (spherical == 1) {
         MakeNormal();
@@ -101,8 +106,6 @@ Maestro::Regrid ()
     // compute cutoff coordinates
     compute_cutoff_coords(rho0_old.dataPtr());
     ComputeCutoffCoords(rho0_old);
-    BaseState<Real> rho0_state(rho0_old, base_geom.max_radial_level+1, base_geom.nr_fine);
-    base_geom.ComputeCutoffCoords(rho0_state.array());
 
     // make gravity
     MakeGravCell(grav_cell_old, rho0_old);
@@ -223,6 +226,9 @@ Maestro::RemakeLevel (int lev, Real time, const BoxArray& ba,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::RemakeLevel()", RemakeLevel);
 
+    // buffers defined on the old grids can no longer be handed out
+    ScratchClear();
+
     const int ng_s = snew[lev].nGrow();
     const int ng_u = unew[lev].nGrow();
     const int ng_S = S_cc_new[lev].nGrow();
@@ -275,6 +281,16 @@ Maestro::RemakeLevel (int lev, Real time, const BoxArray& ba,
     std::swap(intra_state,intra[lev]);
 #endif
 
+    // the old cost has already been used to build dm, so we start
+    // measuring afresh on the new grids
+    burn_cost[lev].define(ba, dm, 1, 0);
+    burn_cost[lev].setVal(0.);
+
+    // the nodal solve is seeded from scratch until the history of pi has
+    // been rebuilt on the new grids
+    pi_hist[0][lev].clear();
+    pi_hist[1][lev].clear();
+
     if (spherical) {
         const int ng_n = normal[lev].nGrow();
         const int ng_c = cell_cc_to_r[lev].nGrow();
@@ -283,6 +299,7 @@ Maestro::RemakeLevel (int lev, Real time, const BoxArray& ba,
         std::swap(      normal_state,      normal[lev]);
         std::swap(cell_cc_to_r_state,cell_cc_to_r[lev]);
     }
+    MakeRadialMap(lev, ba, dm);
 
     if (lev > 0 && reflux_type == 2) {
         flux_reg_s[lev].reset(new FluxRegister(ba, dm, refRatio(lev-1), lev, Nscal));
@@ -314,11 +331,14 @@ Maestro::MakeNewLevelFromCoarse (int lev, Real time, const BoxArray& ba,
 #ifdef SDC
     intra[lev].define             (ba, dm,          Nscal, 0);
 #endif
+    burn_cost[lev].define         (ba, dm,              1, 0);
+    burn_cost[lev].setVal(0.);
 
     if (spherical) {
         normal      [lev].define(ba, dm, 3, 1);
         cell_cc_to_r[lev].define(ba, dm, 1, 0);
     }
+    MakeRadialMap(lev, ba, dm);
 
     if (lev > 0 && reflux_type == 2) {
         flux_reg_s[lev].reset(new FluxRegister(ba, dm, refRatio(lev-1), lev, Nscal));
@@ -354,12 +374,17 @@ Maestro::ClearLevel (int lev)
     w0_cart[lev].clear();
     rhcc_for_nodalproj[lev].clear();
     pi[lev].clear();
+    pi_hist[0][lev].clear();
+    pi_hist[1][lev].clear();
 #ifdef SDC
     intra[lev].clear();
 #endif
+    burn_cost[lev].clear();
     if (spherical) {
         normal[lev].clear();
         cell_cc_to_r[lev].clear();
+        cell_radius[lev].clear();
+        cell_irreg_r[lev].clear();
     }
 
     flux_reg_s[lev].reset(nullptr);
@@ -11,14 +11,6 @@ Maestro::TfromRhoH (Vector<MultiFab>& scal,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::TfromRhoH()", TfromRhoH);
 
-    Vector<MultiFab> p0_cart(finest_level+1);
-
-    for (int lev=0; lev<=finest_level; ++lev) {
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-        p0_cart[lev].setVal(0.);
-    }
-    Put1dArrayOnCart(p0,p0_cart,0,0,bcs_f,0);
-
     const auto use_eos_e_instead_of_h_loc = use_eos_e_instead_of_h;
 
     for (int lev=0; lev<=finest_level; ++lev) {
@@ -32,7 +24,7 @@ Maestro::TfromRhoH (Vector<MultiFab>& scal,
             const Box& tileBox = mfi.tilebox();
 
             const Array4<Real> state = scal[lev].array(mfi);
-            const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
+            const auto p0_arr = MakeBaseStateCart(lev, mfi, p0, 0);
 
             if (use_eos_e_instead_of_h_loc) {
                 // (rho, (h->e)) --> T, p
@@ -89,14 +81,6 @@ Maestro::TfromRhoP (Vector<MultiFab>& scal,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::TfromRhoP()", TfromRhoP);
 
-    Vector<MultiFab> p0_cart(finest_level+1);
-
-    for (int lev=0; lev<=finest_level; ++lev) {
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-        p0_cart[lev].setVal(0.);
-    }
-    Put1dArrayOnCart(p0, p0_cart, 0, 0, bcs_f, 0);
-
     const auto use_pprime_in_tfromp_loc = use_pprime_in_tfromp;
 
     for (int lev=0; lev<=finest_level; ++lev) {
@@ -110,7 +94,7 @@ Maestro::TfromRhoP (Vector<MultiFab>& scal,
             // Get the index space of the valid region
             const Box& tileBox = mfi.tilebox();
             const Array4<Real> state = scal[lev].array(mfi);
-            const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
+            const auto p0_arr = MakeBaseStateCart(lev, mfi, p0, 0);
 
             // (rho, p) --> T
             AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
@@ -210,14 +194,6 @@ Maestro::MachfromRhoH (const Vector<MultiFab>& scal,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MachfromRhoH()", MachfromRhoH);
 
-    Vector<MultiFab> p0_cart(finest_level+1);
-
-    for (int lev=0; lev<=finest_level; ++lev) {
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-        p0_cart[lev].setVal(0.);
-    }
-    Put1dArrayOnCart(p0, p0_cart, 0, 0, bcs_f, 0);
-
     const auto use_eos_e_instead_of_h_loc = use_eos_e_instead_of_h;
 
     for (int lev=0; lev<=finest_level; ++lev) {
@@ -232,7 +208,7 @@ Maestro::MachfromRhoH (const Vector<MultiFab>& scal,
             const Box& tileBox = mfi.tilebox();
             const Array4<const Real> state = scal[lev].array(mfi);
             const Array4<const Real> u = vel[lev].array(mfi);
-            const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
+            const auto p0_arr = MakeBaseStateCart(lev, mfi, p0, 0);
             const Array4<const Real> w0_arr = w0cart[lev].array(mfi);
             const Array4<Real> mach_arr = mach[lev].array(mfi);
 
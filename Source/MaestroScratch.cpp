@@ -0,0 +1,75 @@
+#include <Maestro.H>
+
+using namespace amrex;
+
+// hand out a MultiFab with the requested layout, reusing a buffer
+// from the scratch pool if one matches.  The contents of a reused
+// buffer are whatever was left in it, exactly as with a freshly
+// defined MultiFab, so callers must initialize the data themselves.
+void
+Maestro::ScratchAlloc (MultiFab& mf,
+                       const BoxArray& ba,
+                       const DistributionMapping& dm,
+                       const int ncomp,
+                       const int ngrow)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::ScratchAlloc()",ScratchAlloc);
+
+    if (use_scratch_pool) {
+        for (auto it = scratch_pool.begin(); it != scratch_pool.end(); ++it) {
+            const MultiFab& pmf = **it;
+            // the BoxArray comparison also covers the index type
+            if (pmf.nComp() == ncomp &&
+                pmf.nGrow() == ngrow &&
+                pmf.DistributionMap() == dm &&
+                pmf.boxArray() == ba) {
+                mf = std::move(**it);
+                scratch_pool.erase(it);
+                return;
+            }
+        }
+    }
+
+    mf.define(ba, dm, ncomp, ngrow);
+}
+
+// give a MultiFab back to the scratch pool.  If the pool is disabled
+// the memory is released immediately
+void
+Maestro::ScratchFree (MultiFab& mf)
+{
+    if (use_scratch_pool && mf.ok()) {
+        scratch_pool.emplace_back(new MultiFab(std::move(mf)));
+    }
+    mf.clear();
+}
+
+void
+Maestro::ScratchFree (Vector<MultiFab>& mf)
+{
+    for (int lev = 0; lev < mf.size(); ++lev) {
+        ScratchFree(mf[lev]);
+    }
+}
+
+void
+Maestro::ScratchFree (Vector<std::array< MultiFab, AMREX_SPACEDIM > >& mf)
+{
+    for (int lev = 0; lev < mf.size(); ++lev) {
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            ScratchFree(mf[lev][idim]);
+        }
+    }
+}
+
+// release every buffer held in the scratch pool.  This must be called
+// whenever the grids change, since none of the buffers can be reused
+void
+Maestro::ScratchClear ()
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::ScratchClear()",ScratchClear);
+
+    scratch_pool.clear();
+}
@@ -67,6 +67,9 @@ Maestro::Setup ()
     // set up BCRec definitions for BC types
     BCSetup();
 
+    // multigrid settings of the MAC and nodal projections
+    SolverSetup();
+
     const Box domainBoxFine = geom[max_level].Domain();
     const Real* dxFine = geom[max_level].CellSize();
 
@@ -212,8 +215,13 @@ Maestro::Setup ()
     intra             .resize(max_level+1);
     w0_cart           .resize(max_level+1);
     rhcc_for_nodalproj.resize(max_level+1);
+    pi_hist[0]        .resize(max_level+1);
+    pi_hist[1]        .resize(max_level+1);
     normal            .resize(max_level+1);
     cell_cc_to_r      .resize(max_level+1);
+    cell_radius       .resize(max_level+1);
+    cell_irreg_r      .resize(max_level+1);
+    burn_cost         .resize(max_level+1);
 
     // stores fluxes at coarse-fine interface for synchronization
     // this will be sized "max_level+2"
@@ -0,0 +1,190 @@
+#include <Maestro.H>
+
+#include <cmath>
+
+using namespace amrex;
+
+// Slice plotfiles hold the variables in slice_vars on a few axis-aligned
+// planes, for monitoring a run at a higher cadence than full plotfiles
+// allow.  Every slice_int steps (or slice_deltat in time) one plotfile is
+// written for each plane, named <slice_base_name><step>_<normal><n>.
+//
+// A plotfile cannot have fewer dimensions than the build, so each slice
+// is a plotfile whose domain is one level 0 cell thick along the normal.
+// On every level the slice holds the single layer of cells that contains
+// the plane, so the finest data available at each point is kept.
+
+// write a plotfile of slice_vars on each of the planes given by
+// slice_normals and slice_positions
+void
+Maestro::WriteSlices (const int step,
+                      const Real t_in,
+                      const Real dt_in,
+                      const RealVector& rho0_in,
+                      const RealVector& rhoh0_in,
+                      const RealVector& p0_in,
+                      const RealVector& gamma1bar_in,
+                      const Vector<MultiFab>& u_in,
+                      Vector<MultiFab>& s_in,
+                      const Vector<MultiFab>& S_cc_in)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::WriteSlices()",WriteSlices);
+
+    // wallclock time
+    const Real strt_total = ParallelDescriptor::second();
+
+    // by default, a single plane normal to the last dimension
+    const std::string default_normals = slice_normals.empty() ?
+        std::string(1, "xyz"[AMREX_SPACEDIM-1]) : slice_normals;
+
+    const auto& normals = GetParamWords("slice_normals", default_normals);
+    const auto& positions = GetParamWords("slice_positions", slice_positions);
+
+    const int nslice = normals.size();
+
+    if (!positions.empty() && static_cast<int>(positions.size()) != nslice) {
+        Abort("WriteSlices: slice_positions must have one entry for each of slice_normals");
+    }
+
+    const Real* problo = geom[0].ProbLo();
+    const Real* probhi = geom[0].ProbHi();
+
+    // the normal direction and position of each plane
+    Vector<int> slice_dir(nslice);
+    Vector<Real> slice_pos(nslice);
+    for (int n = 0; n < nslice; ++n) {
+        const std::string& normal = normals[n];
+        slice_dir[n] = -1;
+        for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+            if (normal.size() == 1 && normal[0] == "xyz"[dir]) {
+                slice_dir[n] = dir;
+            }
+        }
+        if (slice_dir[n] < 0) {
+            Abort("WriteSlices: invalid slice normal " + normal);
+        }
+
+        const int dir = slice_dir[n];
+        slice_pos[n] = positions.empty() ? 0.5*(problo[dir] + probhi[dir]) :
+            std::stod(positions[n]);
+        if (slice_pos[n] < problo[dir] || slice_pos[n] > probhi[dir]) {
+            Abort("WriteSlices: slice position " + positions[n] + " is outside the domain");
+        }
+    }
+
+    int nPlot = 0;
+    const auto& varnames = PlotFileVarNames(&nPlot);
+    const auto& slice_varnames = SelectPlotFileVarNames("slice_vars", slice_vars,
+                                                        varnames);
+    const int nvar = slice_varnames.size();
+
+    if (nslice == 0 || nvar == 0) {
+        return;
+    }
+
+    // the base state on the cartesian grid, as PlotFileMF needs it
+    Vector<MultiFab> rho0_cart;
+    Vector<MultiFab> rhoh0_cart;
+    Vector<MultiFab> p0_cart;
+    Vector<MultiFab> gamma1bar_cart;
+    PlotFileBaseStateCart(rho0_in,rhoh0_in,p0_in,gamma1bar_in,
+                          rho0_cart,rhoh0_cart,p0_cart,gamma1bar_cart);
+
+    // the variables are computed once for all the planes
+    const auto& mf = PlotFileMF(varnames,slice_varnames,t_in,dt_in,rho0_cart,
+                                rhoh0_cart,p0_cart,gamma1bar_cart,u_in,s_in,
+                                p0_in,gamma1bar_in,S_cc_in);
+
+    for (int n = 0; n < nslice; ++n) {
+
+        const int dir = slice_dir[n];
+        const Real pos = slice_pos[n];
+
+        // the domain of the slice on level 0: the layer of cells that
+        // contains the plane
+        Box slice_domain = geom[0].Domain();
+        const int i0 = amrex::min(amrex::max(
+            int(std::floor((pos - problo[dir]) / geom[0].CellSize(dir))),
+            slice_domain.smallEnd(dir)), slice_domain.bigEnd(dir));
+        slice_domain.setSmall(dir, i0);
+        slice_domain.setBig(dir, i0);
+
+        RealBox slice_rb(problo, probhi);
+        slice_rb.setLo(dir, problo[dir] + i0*geom[0].CellSize(dir));
+        slice_rb.setHi(dir, problo[dir] + (i0+1)*geom[0].CellSize(dir));
+
+        int is_periodic[AMREX_SPACEDIM];
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            is_periodic[idim] = idim == dir ? 0 : geom[0].isPeriodic(idim);
+        }
+
+        Vector<MultiFab> slice(finest_level+1);
+        Vector<Geometry> slice_geom(finest_level+1);
+
+        int nlevs = 0;
+        for (int lev=0; lev<=finest_level; ++lev) {
+
+            if (lev > 0) {
+                slice_domain.refine(refRatio(lev-1));
+            }
+
+            const int ilev = amrex::min(amrex::max(
+                int(std::floor((pos - problo[dir]) / geom[lev].CellSize(dir))),
+                slice_domain.smallEnd(dir)), slice_domain.bigEnd(dir));
+
+            Box plane = geom[lev].Domain();
+            plane.setSmall(dir, ilev);
+            plane.setBig(dir, ilev);
+
+            // the parts of the grids on the plane, each kept on the rank
+            // that owns its grid so the copy below stays local
+            BoxList bl;
+            Vector<int> pmap;
+            for (int i = 0; i < grids[lev].size(); ++i) {
+                const Box bx = grids[lev][i] & plane;
+                if (bx.ok()) {
+                    bl.push_back(bx);
+                    pmap.push_back(dmap[lev][i]);
+                }
+            }
+
+            // the finer levels are nested in this one, so they do not
+            // reach the plane either
+            if (bl.isEmpty()) {
+                break;
+            }
+
+            slice[lev].define(BoxArray(bl), DistributionMapping(pmap), nvar, 0);
+            slice[lev].ParallelCopy(*mf[lev], 0, 0, nvar);
+
+            slice_geom[lev].define(slice_domain, &slice_rb, geom[lev].Coord(),
+                                   is_periodic);
+
+            ++nlevs;
+        }
+
+        std::string slicefilename = slice_base_name;
+        PlotFileName(step, &slicefilename);
+        slicefilename += "_" + normals[n] + std::to_string(n);
+
+        Vector<int> step_array(nlevs, step);
+
+        WriteMultiLevelPlotfile(slicefilename, nlevs, GetVecOfConstPtrs(slice),
+                                slice_varnames, slice_geom, t_in, step_array,
+                                refRatio());
+    }
+
+    for (int lev=0; lev<=finest_level; ++lev) {
+        delete mf[lev];
+    }
+
+    // wallclock time
+    Real end_total = ParallelDescriptor::second() - strt_total;
+
+    // print wallclock time
+    ParallelDescriptor::ReduceRealMax(end_total,ParallelDescriptor::IOProcessorNumber());
+    if (maestro_verbose > 0) {
+        Print() << "Time to write slices: " << end_total << '\n';
+    }
+}
@@ -0,0 +1,300 @@
+#include <Maestro.H>
+
+using namespace amrex;
+
+// The linear operators used by the MAC and nodal projections and by the
+// thermal diffusion are built on the first call after the grids change
+// and then reused until the next regrid.  Building an operator sets up
+// the multigrid coarsening hierarchy, agglomeration/consolidation, the
+// boundary registers and the communication metadata, all of which depend
+// only on the grids and the domain boundary conditions.  Callers only
+// reset the coefficients and the level boundary data before each solve.
+
+// operator for the MAC projection, -div B grad phi = RHS
+MLABecLaplacian&
+Maestro::MacLinOp ()
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MacLinOp()", MacLinOp);
+
+    // the autotuner may have moved on to settings that need a
+    // differently built operator
+    if (mac_linop && !mac_linop_config.SameLinOp(mac_tuner.Config())) {
+        mac_linop.reset();
+    }
+
+    if (!mac_linop) {
+        mac_linop_config = mac_tuner.Config();
+
+        LPInfo info = SolverLPInfo(mac_linop_config);
+        mac_linop.reset(new MLABecLaplacian(geom, grids, dmap, info));
+
+        // order of stencil
+        int linop_maxorder = 2;
+        mac_linop->setMaxOrder(linop_maxorder);
+
+        // set boundaries for mlabec using velocity bc's
+        SetMacSolverBCs(*mac_linop);
+    }
+
+    return *mac_linop;
+}
+
+// operator for the nodal projection, div sig grad phi = RHS
+MLNodeLaplacian&
+Maestro::NodalLinOp ()
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::NodalLinOp()", NodalLinOp);
+
+    // the autotuner may have moved on to settings that need a
+    // differently built operator
+    if (nodal_linop && !nodal_linop_config.SameLinOp(nodal_tuner.Config())) {
+        nodal_linop.reset();
+    }
+
+    if (!nodal_linop) {
+        nodal_linop_config = nodal_tuner.Config();
+
+        std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_lobc;
+        std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_hibc;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+        {
+            if (Geom(0).isPeriodic(idim)) {
+                mlmg_lobc[idim] = mlmg_hibc[idim] = LinOpBCType::Periodic;
+            } else {
+                if (phys_bc[idim] == Outflow) {
+                    mlmg_lobc[idim] = LinOpBCType::Dirichlet;
+                } else {
+                    mlmg_lobc[idim] = LinOpBCType::Neumann;
+                }
+
+                if (phys_bc[AMREX_SPACEDIM+idim] == Outflow) {
+                    mlmg_hibc[idim] = LinOpBCType::Dirichlet;
+                } else {
+                    mlmg_hibc[idim] = LinOpBCType::Neumann;
+                }
+            }
+        }
+
+        LPInfo info = SolverLPInfo(nodal_linop_config);
+        info.setMetricTerm(false);
+
+        nodal_linop.reset(new MLNodeLaplacian(geom, grids, dmap, info));
+        nodal_linop->setGaussSeidel(true);
+        nodal_linop->setHarmonicAverage(false);
+
+        // RAP coarsening keeps the dense stencil on the coarse levels
+        if (nodal_linop_config.dense_stencil) {
+            nodal_linop->setCoarseningStrategy(MLNodeLaplacian::CoarseningStrategy::RAP);
+        } else {
+            nodal_linop->setCoarseningStrategy(MLNodeLaplacian::CoarseningStrategy::Sigma);
+        }
+
+        nodal_linop->setDomainBC(mlmg_lobc, mlmg_hibc);
+    }
+
+    return *nodal_linop;
+}
+
+// operator for the implicit thermal diffusion solve,
+// A - dt * div B grad phi = RHS, with the enthalpy boundary conditions
+MLABecLaplacian&
+Maestro::ThermalLinOp ()
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::ThermalLinOp()", ThermalLinOp);
+
+    if (!thermal_linop) {
+        LPInfo info;
+        thermal_linop.reset(new MLABecLaplacian(geom, grids, dmap, info));
+
+        // order of stencil
+        int linop_maxorder = 2;
+        thermal_linop->setMaxOrder(linop_maxorder);
+
+        // set boundaries for mlabec using enthalpy bc's
+        std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_lobc;
+        std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_hibc;
+
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+        {
+            if (Geom(0).isPeriodic(idim)) {
+                mlmg_lobc[idim] = mlmg_hibc[idim] = LinOpBCType::Periodic;
+            }
+            else {
+                // lo-side BCs
+                if (bcs_s[RhoH].lo(idim) == BCType::foextrap) {
+                    mlmg_lobc[idim] = LinOpBCType::Neumann;
+                } else if (bcs_s[RhoH].lo(idim) == BCType::ext_dir) {
+                    mlmg_lobc[idim] = LinOpBCType::Dirichlet;
+                } else {
+                    mlmg_lobc[idim] = LinOpBCType::Neumann;
+                }
+
+                // hi-side BCs
+                if (bcs_s[RhoH].hi(idim) == BCType::foextrap) {
+                    mlmg_hibc[idim] = LinOpBCType::Neumann;
+                } else if (bcs_s[RhoH].hi(idim) == BCType::ext_dir) {
+                    mlmg_hibc[idim] = LinOpBCType::Dirichlet;
+                } else {
+                    mlmg_hibc[idim] = LinOpBCType::Neumann;
+                }
+            }
+        }
+
+        thermal_linop->setDomainBC(mlmg_lobc,mlmg_hibc);
+    }
+
+    return *thermal_linop;
+}
+
+// operator used to apply div B grad to the explicit thermal terms.
+// The domain boundary conditions depend on the component being
+// differentiated, so they are set by ApplyThermal on every call
+MLABecLaplacian&
+Maestro::ThermalApplyLinOp ()
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::ThermalApplyLinOp()", ThermalApplyLinOp);
+
+    if (!thermal_apply_linop) {
+        LPInfo info;
+
+        // turn off multigrid coarsening since no actual solve is performed
+        info.setMaxCoarseningLevel(0);
+
+        thermal_apply_linop.reset(new MLABecLaplacian(geom, grids, dmap, info));
+
+        // order of stencil
+        int stencil_order = 2;
+        thermal_apply_linop->setMaxOrder(stencil_order);
+    }
+
+    return *thermal_apply_linop;
+}
+
+// release the linear operators.  This must be called whenever the grids
+// change, since the operators are built on the grids of every level
+void
+Maestro::SolverClear ()
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::SolverClear()", SolverClear);
+
+    mac_linop.reset();
+    nodal_linop.reset();
+    thermal_linop.reset();
+    thermal_apply_linop.reset();
+}
+
+// build the MAC and nodal multigrid configurations from the runtime
+// parameters.  The mg_* parameters belong to the MAC projection and the
+// hg_* parameters to the nodal projection; the smoother counts are shared
+void
+Maestro::SolverSetup ()
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::SolverSetup()", SolverSetup);
+
+    MLMGConfig mac;
+    mac.cycle_type = mg_cycle_type;
+    mac.nu_1 = mg_nu_1;
+    mac.nu_2 = mg_nu_2;
+    mac.bottom_nu = mg_bottom_nu;
+    mac.bottom_solver = mg_bottom_solver;
+    mac.max_bottom_nlevels = max_mg_bottom_nlevels;
+
+    MLMGConfig nodal = mac;
+    nodal.cycle_type = hg_cycle_type;
+    nodal.bottom_solver = hg_bottom_solver;
+    nodal.dense_stencil = hg_dense_stencil;
+
+    for (auto c : {&mac, &nodal}) {
+        if (c->cycle_type < 1 || c->cycle_type > 3) {
+            Abort("SolverSetup: invalid mg_cycle_type or hg_cycle_type");
+        }
+        // MLMG has no W-cycle
+        if (c->cycle_type == 2) {
+            Print() << "W-cycles are not available, using V-cycles instead" << std::endl;
+            c->cycle_type = 3;
+        }
+        if (c->bottom_solver < -1 || c->bottom_solver > 4) {
+            Abort("SolverSetup: invalid mg_bottom_solver or hg_bottom_solver");
+        }
+        // the multigrid bottom solve works on the agglomerated grids
+        if (c->bottom_solver == 4) {
+            c->agglomeration = true;
+        }
+    }
+
+    mac_tuner.Init(mac, mg_autotune);
+    nodal_tuner.Init(nodal, mg_autotune);
+}
+
+LPInfo
+Maestro::SolverLPInfo (const MLMGConfig& config)
+{
+    LPInfo info;
+    info.setAgglomeration(config.agglomeration);
+    info.setConsolidation(config.consolidation);
+
+    // with the multigrid bottom solver, the levels below the coarsest one
+    // on which the level 0 grids can still be coarsened separately act as
+    // the bottom solver, so limit how many of them there are
+    if (config.bottom_solver == 4) {
+        int nlev = 0;
+        while (nlev < 30 && grids[0].coarsenable(2 << nlev, 2)) {
+            ++nlev;
+        }
+        info.setMaxCoarseningLevel(nlev + std::max(config.max_bottom_nlevels, 1) - 1);
+    }
+
+    return info;
+}
+
+void
+Maestro::SetMLMGOptions (MLMG& mlmg, const MLMGConfig& config)
+{
+    // F-cycles for every iteration
+    if (config.cycle_type == 1) {
+        mlmg.setMaxFmgIter(100);
+    }
+
+    mlmg.setPreSmooth(config.nu_1);
+    mlmg.setPostSmooth(config.nu_2);
+    if (config.bottom_nu >= 0) {
+        mlmg.setBottomSmooth(config.bottom_nu);
+    }
+
+    if (config.bottom_solver == 0) {
+        mlmg.setBottomSolver(MLMG::BottomSolver::smoother);
+    } else if (config.bottom_solver == 2) {
+        mlmg.setBottomSolver(MLMG::BottomSolver::cg);
+    } else if (config.bottom_solver > 0) {
+        // there is no communication-avoiding variant, and the multigrid
+        // bottom solve finishes with BiCGStab on its coarsest level
+        mlmg.setBottomSolver(MLMG::BottomSolver::bicgstab);
+    }
+}
+
+void
+Maestro::SolverTuneRecord (MLMGTuner& tuner,
+                           const Real solve_start,
+                           const std::string& name)
+{
+    if (!tuner.Tuning()) {
+        return;
+    }
+
+    // every rank has to make the same choice
+    Real solve_time = ParallelDescriptor::second() - solve_start;
+    ParallelDescriptor::ReduceRealMax(solve_time);
+
+    tuner.Record(solve_time);
+
+    if (!tuner.Tuning()) {
+        Print() << "mg_autotune: " << name << " solver settled on "
+                << tuner.Config() << std::endl;
+    }
+}
@@ -43,18 +43,9 @@ Maestro::MakeExplicitThermal(Vector<MultiFab>& thermal,
     }
 
     //
-    // Compute thermal = div B grad phi using MLABecLaplacian class
+    // Compute thermal = div B grad phi using the persistent MLABecLaplacian
     //
-    LPInfo info;
-
-    // turn off multigrid coarsening since no actual solve is performed
-    info.setMaxCoarseningLevel(0);
-
-    MLABecLaplacian mlabec(geom, grids, dmap, info);
-
-    // order of stencil
-    int stencil_order = 2;
-    mlabec.setMaxOrder(stencil_order);
+    MLABecLaplacian& mlabec = ThermalApplyLinOp();
 
     if (temp_formulation == 1)
     {
@@ -159,18 +150,9 @@ Maestro::MakeExplicitThermalHterm(Vector<MultiFab>& thermal,
     }
 
     //
-    // Compute thermal = div B grad phi using MLABecLaplacian class
+    // Compute thermal = div B grad phi using the persistent MLABecLaplacian
     //
-    LPInfo info;
-
-    // turn off multigrid coarsening since no actual solve is performed
-    info.setMaxCoarseningLevel(0);
-
-    MLABecLaplacian mlabec(geom, grids, dmap, info);
-
-    // order of stencil
-    int stencil_order = 2;
-    mlabec.setMaxOrder(stencil_order);
+    MLABecLaplacian& mlabec = ThermalApplyLinOp();
 
         // 1. Compute div hcoeff grad h
         mlabec.setScalars(0.0, 1.0);
@@ -283,6 +265,8 @@ Maestro::MakeThermalCoeffs(const Vector<MultiFab>& scal,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeThermalCoeffs()",MakeThermalCoeffs);
 
+    ThermoCacheDefine();
+
     for (int lev = 0; lev <= finest_level; ++lev)
     {
         Print() << "... Level " << lev << " create thermal coeffs:" << std::endl;
@@ -299,6 +283,7 @@ Maestro::MakeThermalCoeffs(const Vector<MultiFab>& scal,
 
             // Get the index space of valid region
             const Box& gtbx = mfi.growntilebox(1);
+            const Array4<ThermoCacheEntry> thermo_cache_arr = ThermoCacheArray(lev, mfi);
 
             const Array4<Real> Tcoeff_arr = Tcoeff[lev].array(mfi);
             const Array4<Real> hcoeff_arr = hcoeff[lev].array(mfi);
@@ -324,7 +309,7 @@ Maestro::MakeThermalCoeffs(const Vector<MultiFab>& scal,
                     }
 
                     // dens, temp and xmass are inputs
-                    eos(eos_input_rt, eos_state);
+                    eos_rt_cached(thermo_cache_arr, i, j, k, eos_state);
                     conductivity(eos_state);
 
                     Tcoeff_arr(i,j,k) = -eos_state.conductivity;
@@ -429,46 +414,10 @@ Maestro::ThermalConduct (const Vector<MultiFab>& s1,
     }
 
     //
-    // Set up implicit solve using MLABecLaplacian class
+    // Set up implicit solve using the persistent MLABecLaplacian, which
+    // already holds the stencil order and enthalpy bc's
     //
-    LPInfo info;
-    MLABecLaplacian mlabec(geom, grids, dmap, info);
-
-    // order of stencil
-    int linop_maxorder = 2;
-    mlabec.setMaxOrder(linop_maxorder);
-
-    // set boundaries for mlabec using enthalpy bc's
-    std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_lobc;
-    std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_hibc;
-
-    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
-    {
-        if (Geom(0).isPeriodic(idim)) {
-            mlmg_lobc[idim] = mlmg_hibc[idim] = LinOpBCType::Periodic;
-        }
-        else {
-            // lo-side BCs
-            if (bcs_s[RhoH].lo(idim) == BCType::foextrap) {
-                mlmg_lobc[idim] = LinOpBCType::Neumann;
-            } else if (bcs_s[RhoH].lo(idim) == BCType::ext_dir) {
-                mlmg_lobc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_lobc[idim] = LinOpBCType::Neumann;
-            }
-
-            // hi-side BCs
-            if (bcs_s[RhoH].hi(idim) == BCType::foextrap) {
-                mlmg_hibc[idim] = LinOpBCType::Neumann;
-            } else if (bcs_s[RhoH].hi(idim) == BCType::ext_dir) {
-                mlmg_hibc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_hibc[idim] = LinOpBCType::Neumann;
-            }
-        }
-    }
-
-    mlabec.setDomainBC(mlmg_lobc,mlmg_hibc);
+    MLABecLaplacian& mlabec = ThermalLinOp();
 
     for (int lev = 0; lev <= finest_level; ++lev) {
         mlabec.setLevelBC(lev, &phi[lev]);
@@ -622,46 +571,10 @@ Maestro::ThermalConductSDC (int which_step,
     }
 
     //
-    // Set up implicit solve using MLABecLaplacian class
+    // Set up implicit solve using the persistent MLABecLaplacian, which
+    // already holds the stencil order and enthalpy bc's
     //
-    LPInfo info;
-    MLABecLaplacian mlabec(geom, grids, dmap, info);
-
-    // order of stencil
-    int linop_maxorder = 2;
-    mlabec.setMaxOrder(linop_maxorder);
-
-    // set boundaries for mlabec using enthalpy bc's
-    std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_lobc;
-    std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_hibc;
-
-    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
-    {
-        if (Geom(0).isPeriodic(idim)) {
-            mlmg_lobc[idim] = mlmg_hibc[idim] = LinOpBCType::Periodic;
-        }
-        else {
-            // lo-side BCs
-            if (bcs_s[RhoH].lo(idim) == BCType::foextrap) {
-                mlmg_lobc[idim] = LinOpBCType::Neumann;
-            } else if (bcs_s[RhoH].lo(idim) == BCType::ext_dir) {
-                mlmg_lobc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_lobc[idim] = LinOpBCType::Neumann;
-            }
-
-            // hi-side BCs
-            if (bcs_s[RhoH].hi(idim) == BCType::foextrap) {
-                mlmg_hibc[idim] = LinOpBCType::Neumann;
-            } else if (bcs_s[RhoH].hi(idim) == BCType::ext_dir) {
-                mlmg_hibc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_hibc[idim] = LinOpBCType::Neumann;
-            }
-        }
-    }
-
-    mlabec.setDomainBC(mlmg_lobc,mlmg_hibc);
+    MLABecLaplacian& mlabec = ThermalLinOp();
 
     for (int lev = 0; lev <= finest_level; ++lev) {
         mlabec.setLevelBC(lev, &phi[lev]);
@@ -0,0 +1,75 @@
+#include <Maestro.H>
+
+using namespace amrex;
+
+// make sure the thermodynamic cache is defined on the current grids.
+// This must be called before any of the EOS loops that use the cache,
+// outside of any MFIter loop.  Redefining the cache (after a regrid)
+// empties it
+void
+Maestro::ThermoCacheDefine ()
+{
+    if (!use_thermo_cache) {
+        return;
+    }
+
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::ThermoCacheDefine()",ThermoCacheDefine);
+
+    thermo_cache.resize(max_level+1);
+
+    for (int lev=0; lev<=finest_level; ++lev) {
+
+        if (thermo_cache[lev].ok() &&
+            thermo_cache[lev].boxArray() == grids[lev] &&
+            thermo_cache[lev].DistributionMap() == dmap[lev]) {
+            continue;
+        }
+
+        thermo_cache[lev].define(grids[lev], dmap[lev], 1, 0);
+
+        // mark every entry as empty; a negative density never matches
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for ( MFIter mfi(thermo_cache[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
+
+            const Box& tileBox = mfi.tilebox();
+            const Array4<ThermoCacheEntry> cache = thermo_cache[lev].array(mfi);
+
+            AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
+                cache(i,j,k).rho = -1.0;
+            });
+        }
+    }
+
+    for (int lev=finest_level+1; lev<thermo_cache.size(); ++lev) {
+        thermo_cache[lev].clear();
+    }
+}
+
+// the cache entries for the tile of mfi at level lev, or an empty
+// Array4 (which makes eos_rt_cached call the EOS directly) if the
+// cache is disabled.  The view covers only mfi.tilebox(), so every
+// entry belongs to one tile and is never touched by two threads; zones
+// outside it (the ghost zones of a growntilebox loop, which are the
+// valid zones of a neighbouring tile) call the EOS directly
+Array4<ThermoCacheEntry>
+Maestro::ThermoCacheArray (const int lev, const MFIter& mfi)
+{
+    if (!use_thermo_cache) {
+        return Array4<ThermoCacheEntry>();
+    }
+
+    const Box& tileBox = mfi.tilebox();
+    const auto lo = amrex::lbound(tileBox);
+    const auto hi = amrex::ubound(tileBox);
+
+    // same strides as the whole fab, with the bounds of the tile
+    Array4<ThermoCacheEntry> cache = thermo_cache[lev].array(mfi);
+    cache.p = cache.ptr(lo.x, lo.y, lo.z);
+    cache.begin = lo;
+    cache.end = Dim3{hi.x+1, hi.y+1, hi.z+1};
+
+    return cache;
+}
@@ -0,0 +1,181 @@
+#include <Maestro.H>
+
+using namespace amrex;
+
+// reset the per-step timing ledger at the start of an advance
+void
+Maestro::TimingLedgerBegin ()
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::TimingLedgerBegin()",TimingLedgerBegin);
+
+    ledger_phase_names.clear();
+    ledger_phase_times.clear();
+    ledger_current_phase = -1;
+    ledger_step_start = ParallelDescriptor::second();
+}
+
+// close the phase currently being timed (if any) and start timing `phase`.
+// phase names take the form "stepN:subphase"; a phase that is entered
+// more than once in a step (e.g. SDC iterations) accumulates its time
+void
+Maestro::TimingLedgerMark (const std::string& phase)
+{
+    const Real now = ParallelDescriptor::second();
+
+    if (ledger_current_phase >= 0) {
+        ledger_phase_times[ledger_current_phase] += now - ledger_phase_start;
+    }
+
+    ledger_current_phase = -1;
+    for (int i = 0; i < ledger_phase_names.size(); ++i) {
+        if (ledger_phase_names[i] == phase) {
+            ledger_current_phase = i;
+            break;
+        }
+    }
+
+    if (ledger_current_phase < 0) {
+        ledger_phase_names.push_back(phase);
+        ledger_phase_times.push_back(0.0);
+        ledger_current_phase = ledger_phase_names.size()-1;
+    }
+
+    ledger_phase_start = now;
+}
+
+// close the last phase, reduce the phase timings across ranks and
+// append one JSON record for this step to timing_ledger_file
+void
+Maestro::TimingLedgerEnd (const std::string& advance_name,
+                          const bool is_initIter)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::TimingLedgerEnd()",TimingLedgerEnd);
+
+    const Real now = ParallelDescriptor::second();
+
+    if (ledger_current_phase >= 0) {
+        ledger_phase_times[ledger_current_phase] += now - ledger_phase_start;
+        ledger_current_phase = -1;
+    }
+
+    if (timing_ledger_file.empty()) {
+        return;
+    }
+
+    const int nprocs = ParallelDescriptor::NProcs();
+    const int ioproc = ParallelDescriptor::IOProcessorNumber();
+    const int nphase = ledger_phase_names.size();
+    const int nlevs = finest_level+1;
+
+    // the STEPs are keyed by the part of the phase name before the ':'
+    Vector<std::string> step_names;
+    Vector<int> phase_to_step(nphase);
+    for (int i = 0; i < nphase; ++i) {
+        const std::string step_name = ledger_phase_names[i].substr(0, ledger_phase_names[i].find(':'));
+        auto it = std::find(step_names.begin(), step_names.end(), step_name);
+        phase_to_step[i] = it - step_names.begin();
+        if (it == step_names.end()) {
+            step_names.push_back(step_name);
+        }
+    }
+    const int nstep = step_names.size();
+
+    // pack the sub-phases, the STEP sums, the total step time,
+    // and the locally owned cells and boxes on every level
+    const int istep_off  = nphase;
+    const int itotal     = istep_off + nstep;
+    const int ilev_off   = itotal + 1;
+    const int nvals      = ilev_off + 2*nlevs;
+
+    Vector<Real> vals(nvals, 0.0);
+    for (int i = 0; i < nphase; ++i) {
+        vals[i] = ledger_phase_times[i];
+        vals[istep_off+phase_to_step[i]] += ledger_phase_times[i];
+    }
+    vals[itotal] = now - ledger_step_start;
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        Real local_cells = 0.0;
+        Real local_boxes = 0.0;
+        for (int i = 0; i < grids[lev].size(); ++i) {
+            if (dmap[lev][i] == ParallelDescriptor::MyProc()) {
+                local_cells += grids[lev][i].numPts();
+                local_boxes += 1.0;
+            }
+        }
+        vals[ilev_off+2*lev  ] = local_cells;
+        vals[ilev_off+2*lev+1] = local_boxes;
+    }
+
+    Vector<Real> vmin(vals);
+    Vector<Real> vmax(vals);
+    Vector<Real> vsum(vals);
+
+    ParallelDescriptor::ReduceRealMin(vmin.dataPtr(),nvals,ioproc);
+    ParallelDescriptor::ReduceRealMax(vmax.dataPtr(),nvals,ioproc);
+    ParallelDescriptor::ReduceRealSum(vsum.dataPtr(),nvals,ioproc);
+
+    if (ParallelDescriptor::IOProcessor()) {
+
+        std::ofstream ledger(timing_ledger_file, std::ofstream::out |
+                             std::ofstream::app | std::ofstream::binary);
+
+        ledger.precision(6);
+        ledger << std::scientific;
+
+        auto write_stats = [&] (const int i) {
+            ledger << "\"min\":" << vmin[i]
+                   << ",\"mean\":" << vsum[i]/nprocs
+                   << ",\"max\":" << vmax[i];
+        };
+
+        ledger << "{\"advance\":\"" << advance_name << "\""
+               << ",\"step\":" << istep
+               << ",\"init_iter\":" << (is_initIter ? "true" : "false")
+               << ",\"time\":" << t_old
+               << ",\"dt\":" << dt
+               << ",\"nprocs\":" << nprocs;
+
+        // wallclock for the whole step
+        ledger << ",\"total\":{";
+        write_stats(itotal);
+        ledger << "}";
+
+        // wallclock for each sub-phase, in the order they were first entered
+        ledger << ",\"phases\":[";
+        for (int i = 0; i < nphase; ++i) {
+            ledger << (i > 0 ? "," : "") << "{\"name\":\"" << ledger_phase_names[i] << "\",";
+            write_stats(i);
+            ledger << "}";
+        }
+        ledger << "]";
+
+        // wallclock summed over all the sub-phases of each STEP
+        ledger << ",\"steps\":[";
+        for (int i = 0; i < nstep; ++i) {
+            ledger << (i > 0 ? "," : "") << "{\"name\":\"" << step_names[i] << "\",";
+            write_stats(istep_off+i);
+            ledger << "}";
+        }
+        ledger << "]";
+
+        // per-level work distribution, so that imbalance in the phase
+        // timings can be traced back to the cells each rank owns
+        ledger << ",\"levels\":[";
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            ledger << (lev > 0 ? "," : "") << "{\"level\":" << lev
+                   << ",\"cells\":" << grids[lev].numPts()
+                   << ",\"boxes\":" << grids[lev].size()
+                   << ",\"local_cells\":{";
+            write_stats(ilev_off+2*lev);
+            ledger << "},\"local_boxes\":{";
+            write_stats(ilev_off+2*lev+1);
+            ledger << "}}";
+        }
+        ledger << "]}" << std::endl;
+
+        ledger.close();
+    }
+}
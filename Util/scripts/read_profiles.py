@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+
+"""Read the radial profiles that MAESTROeX appends to profile_file.
+
+The layout of the file is described in Source/MaestroProfile.cpp.  As a
+script this prints a summary of the file; as a module, read_profiles()
+returns the profiles as numpy arrays.
+"""
+
+import struct
+import sys
+
+import numpy as np
+
+
+def read_profiles(filename):
+    """Return (r, names, steps, times, profiles), where profiles has shape
+    (nrecord, nvar, 4, nbin) and the third axis is mean, rms, min, max."""
+
+    with open(filename, "rb") as f:
+        data = f.read()
+
+    if data[:8] != b"MAESTRPF":
+        sys.exit(f"{filename} is not a radial profile file")
+
+    # the endian tag tells the byte order of the writer
+    if struct.unpack("<I", data[8:12])[0] == 0x01020304:
+        bo = "<"
+    else:
+        bo = ">"
+
+    version, real_size, nvar, nbin = struct.unpack(bo + "IIIQ", data[12:32])
+    if version != 1:
+        sys.exit(f"{filename}: unknown version {version}")
+
+    real = np.dtype(bo + ("f8" if real_size == 8 else "f4"))
+
+    pos = 32
+    names = []
+    for _ in range(nvar):
+        length = struct.unpack(bo + "I", data[pos:pos+4])[0]
+        names.append(data[pos+4:pos+4+length].decode())
+        pos += 4 + length
+
+    r = np.frombuffer(data, dtype=real, count=nbin, offset=pos)
+    pos += nbin * real_size
+
+    record_size = 8 + real_size + nvar * 4 * nbin * real_size
+    nrecord = (len(data) - pos) // record_size
+
+    steps = np.empty(nrecord, dtype=np.int64)
+    times = np.empty(nrecord)
+    profiles = np.empty((nrecord, nvar, 4, nbin))
+
+    for n in range(nrecord):
+        steps[n] = struct.unpack(bo + "q", data[pos:pos+8])[0]
+        times[n] = np.frombuffer(data, dtype=real, count=1, offset=pos+8)[0]
+        profiles[n] = np.frombuffer(data, dtype=real, count=nvar*4*nbin,
+                                    offset=pos+8+real_size).reshape(nvar, 4, nbin)
+        pos += record_size
+
+    return r, names, steps, times, profiles
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: read_profiles.py radial_profiles.bin")
+
+    r, names, steps, times, profiles = read_profiles(sys.argv[1])
+
+    print(f"{len(r)} radial bins from {r[0]:g} to {r[-1]:g}")
+    print("variables: " + " ".join(names))
+    print(f"{len(steps)} records", end="")
+    if len(steps) > 0:
+        print(f", steps {steps[0]} to {steps[-1]}, times {times[0]:g} to {times[-1]:g}")
+    else:
+        print()
+
+
+if __name__ == "__main__":
+    main()